@@ -0,0 +1,610 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Benchmarks for native_cpp. Every curve is timed through each way of calling it:
+ *
+ *   Direct/<curve>       EasingFunctions::Ease<E>, the curve known at compile time and inlined
+ *   Switch/<curve>       GetEaseFromType per element, with the same type every call
+ *   Pointer/<curve>      the function pointer from GetEasingFunction, per element
+ *   Batch/<curve>        GetEaseFromTypeBatch
+ *   Simd/<curve>         EasingFunctionsSimd::GetEaseFromTypeBatch at the widest level this CPU supports
+ *   Table/<curve>        EasingCurveTable<1024> with Hermite interpolation, EvaluateBatch
+ *   Derivative/<curve>   GetEaseDerivativeFromType per element
+ *   Fused/<curve>        GetEaseWithVelocityFromType per element (value and velocity)
+ *   Inverse/<curve>      GetEaseInverseFromType per element, for values spread over the start..end range
+ *   Distance/<curve>     EasingIntegralTable<1024>::Distance per element, over [alpha / 2, alpha]
+ *
+ * The custom curves go through EasingCurve, the CSS cubic-bezier keywords and a three key keyframe curve:
+ *
+ *   Bezier/<curve>       EasingCurve::Evaluate per element
+ *   BezierBatch/<curve>  EasingCurve::EvaluateBatch, which solves the beziers through EasingFunctionsSimd
+ *   Keyframes/<count>    EasingCurve::Evaluate per element, over <count> keys
+ *
+ * Compose/InOutBounce rebuilds InOutBounce as EasingCompose::InOut(Mirror(OutBounce)); compare it with
+ * Direct/InOutBounce. ComposeFunction/InOutBounce builds the same curve from nested std::function calls.
+ *
+ * FixedQ16/<curve> and FixedQ32/<curve> time EasingFixedPoint::GetEaseFromTypeBatch on the same data converted to
+ * Q16.16 and Q32.32; compare them with Batch/<curve> for the price of bit-identical results.
+ *
+ * Double/<curve>, Half/<curve> and BFloat16/<curve> time EasingPrecision<T>::GetEaseFromTypeBatch on the same data
+ * stored as double, IEEE half and bfloat16. The 16 bit ones run the Simd kernels between conversions, so compare them
+ * with Simd/<curve>; on a buffer too large for the cache they move half the bytes.
+ *
+ * Stepper/<curve> advances an EasingPolynomialStepper per element by one fixed tick, for Linear and Quad to Quint, and
+ * Recurrence/<curve> an EasingRecurrenceStepper, for Sine, Expo and Elastic; compare them with Switch/<curve>, which
+ * evaluates the same curve from alpha.
+ *
+ * Envelope/<curve> renders 512 sample blocks of a one second EasingEnvelope at 48 kHz, reported per sample.
+ *
+ * The Dispatch benchmarks run GetEaseFromType over mixed curve types, once sorted into runs of the same type and once
+ * shuffled, so the cost of a mispredicted switch shows up as the difference between the two. The TweenPool ones time
+ * EasingTweenPool::Update.
+ *
+ * Results are reported per evaluation, in the JSON layout of Google Benchmark (name, iterations, real_time, time_unit,
+ * items_per_second), so existing comparison tooling works on them.
+ *
+ *   g++ -std=c++17 -O2 -pthread -Inative_cpp benchmarks/NativeCpp_bench.cpp -o NativeCpp_bench
+ *   ./NativeCpp_bench [--filter=<substring>] [--min_time=<seconds>] [--json=<file>]
+ */
+
+#include "EasingCompose.hpp"
+#include "EasingCurve.hpp"
+#include "EasingCurveTable.hpp"
+#include "EasingEnvelope.hpp"
+#include "EasingFixedPoint.hpp"
+#include "EasingFunctions.hpp"
+#include "EasingFunctionsSimd.hpp"
+#include "EasingIntegralTable.hpp"
+#include "EasingPrecision.hpp"
+#include "EasingStepper.hpp"
+#include "EasingTweenPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    const char* const EaseNames[EasingFunctions::EASE_TYPE_COUNT] =
+    {
+        "Linear", "Spring",
+        "InQuad", "OutQuad", "InOutQuad",
+        "InCubic", "OutCubic", "InOutCubic",
+        "InQuart", "OutQuart", "InOutQuart",
+        "InQuint", "OutQuint", "InOutQuint",
+        "InSine", "OutSine", "InOutSine",
+        "InExpo", "OutExpo", "InOutExpo",
+        "InCirc", "OutCirc", "InOutCirc",
+        "InBounce", "OutBounce", "InOutBounce",
+        "InBack", "OutBack", "InOutBack",
+        "InElastic", "OutElastic", "InOutElastic"
+    };
+
+    const std::size_t ElementCount = 4096;
+
+    struct BenchData
+    {
+        std::vector<float> Start;
+        std::vector<float> End;
+        std::vector<float> Alpha;
+        std::vector<float> Out;
+        std::vector<EEaseType> SortedTypes;
+        std::vector<EEaseType> ShuffledTypes;
+    };
+
+    struct BenchResult
+    {
+        std::string Name;
+        std::size_t Iterations;
+        double NanosecondsPerItem;
+    };
+
+    struct BenchOptions
+    {
+        std::string Filter;
+        std::string JsonPath;
+        double MinTime = 0.1;
+    };
+
+    template<typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink = nullptr;
+        sink = &value;
+#endif
+    }
+
+    bool IsSelected(const BenchOptions& options, const std::string& name)
+    {
+        return options.Filter.empty() || name.find(options.Filter) != std::string::npos;
+    }
+
+    //
+    // Runs `body` (which evaluates `items` eases) until minTime has passed and records the time per ease.
+    //
+    template<typename TBody>
+    void Run(const BenchOptions& options, std::vector<BenchResult>& results, const std::string& name, std::size_t items, TBody&& body)
+    {
+        if (!IsSelected(options, name)) {
+            return;
+        }
+
+        typedef std::chrono::steady_clock Clock;
+
+        body();
+
+        std::size_t iterations = 0;
+        const Clock::time_point begin = Clock::now();
+        double elapsed = 0.0;
+
+        // Check the clock only every few iterations so it does not show up in the fast benchmarks.
+        while (elapsed < options.MinTime) {
+            for (int i = 0; i < 8; ++i) {
+                body();
+            }
+
+            iterations += 8;
+            elapsed = std::chrono::duration<double>(Clock::now() - begin).count();
+        }
+
+        BenchResult result;
+        result.Name = name;
+        result.Iterations = iterations;
+        result.NanosecondsPerItem = elapsed * 1e9 / (double(iterations) * double(items));
+        results.push_back(result);
+
+        std::printf("%-28s %10.3f ns/eval %12.1f M evals/s\n", name.c_str(), result.NanosecondsPerItem, 1e3 / result.NanosecondsPerItem);
+    }
+
+    template<EEaseType EaseType>
+    void RunDirect(const BenchData& data, float* out)
+    {
+        for (std::size_t i = 0; i < ElementCount; ++i) {
+            out[i] = EasingFunctions::Ease<EaseType>(data.Start[i], data.End[i], data.Alpha[i]);
+        }
+    }
+
+    typedef void (*DirectFunc)(const BenchData&, float*);
+
+    template<std::size_t... Types>
+    std::vector<DirectFunc> MakeDirectFuncs(std::index_sequence<Types...>)
+    {
+        return { &RunDirect<EEaseType(Types)>... };
+    }
+
+    void RunCurveBenchmarks(const BenchOptions& options, BenchData& data, std::vector<BenchResult>& results)
+    {
+        const std::vector<DirectFunc> direct = MakeDirectFuncs(std::make_index_sequence<EasingFunctions::EASE_TYPE_COUNT>());
+
+        const float* start = data.Start.data();
+        const float* end = data.End.data();
+        const float* alpha = data.Alpha.data();
+        float* out = data.Out.data();
+
+        std::vector<float> values(ElementCount);
+        std::vector<float> halfAlpha(ElementCount);
+        static EasingIntegralTable<1024> integrals;
+
+        for (std::size_t i = 0; i < ElementCount; ++i) {
+            values[i] = start[i] + (end[i] - start[i]) * alpha[i];
+            halfAlpha[i] = 0.5f * alpha[i];
+        }
+
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+            const std::string name = EaseNames[type];
+
+            // Read the type through a volatile so the Switch benchmark cannot fold the dispatch away.
+            volatile unsigned int opaqueType = type;
+            const EEaseType runtimeType = EEaseType(opaqueType);
+
+            Run(options, results, "Direct/" + name, ElementCount, [&]() {
+                direct[type](data, out);
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, "Switch/" + name, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = EasingFunctions::GetEaseFromType(runtimeType, start[i], end[i], alpha[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+
+            EasingFunctions::EasingFunc<float> func = EasingFunctions::GetEasingFunction(runtimeType);
+            DoNotOptimize(func);
+
+            Run(options, results, "Pointer/" + name, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = func(start[i], end[i], alpha[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, "Batch/" + name, ElementCount, [&]() {
+                EasingFunctions::GetEaseFromTypeBatch(runtimeType, start, end, alpha, out, ElementCount);
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, "Simd/" + name, ElementCount, [&]() {
+                EasingFunctionsSimd::GetEaseFromTypeBatch(runtimeType, start, end, alpha, out, ElementCount);
+                DoNotOptimize(out[0]);
+            });
+
+            const EasingCurveTable<1024> table(easeType, EASE_TABLE_HERMITE);
+
+            Run(options, results, "Table/" + name, ElementCount, [&]() {
+                table.EvaluateBatch(start, end, alpha, out, ElementCount);
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, "Derivative/" + name, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = EasingFunctions::GetEaseDerivativeFromType(runtimeType, start[i], end[i], alpha[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, "Fused/" + name, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    const EasingFunctions::EaseSample<float> sample = EasingFunctions::GetEaseWithVelocityFromType(runtimeType, start[i], end[i], alpha[i]);
+                    out[i] = sample.Value + sample.Velocity;
+                }
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, "Inverse/" + name, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = EasingFunctions::GetEaseInverseFromType(runtimeType, start[i], end[i], values[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+
+            integrals.Bake(easeType);
+
+            Run(options, results, "Distance/" + name, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = integrals.Distance(start[i], end[i], halfAlpha[i], alpha[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+        }
+    }
+
+    void RunCustomCurveBenchmarks(const BenchOptions& options, BenchData& data, std::vector<BenchResult>& results)
+    {
+        const float* start = data.Start.data();
+        const float* end = data.End.data();
+        const float* alpha = data.Alpha.data();
+        float* out = data.Out.data();
+
+        const std::pair<const char*, EasingCurve> beziers[] =
+        {
+            std::make_pair("Ease", EasingCurve::CubicBezier(0.25f, 0.1f, 0.25f, 1.0f)),
+            std::make_pair("EaseIn", EasingCurve::CubicBezier(0.42f, 0.0f, 1.0f, 1.0f)),
+            std::make_pair("EaseOut", EasingCurve::CubicBezier(0.0f, 0.0f, 0.58f, 1.0f)),
+            std::make_pair("EaseInOut", EasingCurve::CubicBezier(0.42f, 0.0f, 0.58f, 1.0f))
+        };
+
+        for (const auto& bezier : beziers) {
+            const EasingCurve& curve = bezier.second;
+
+            Run(options, results, std::string("Bezier/") + bezier.first, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = curve.Evaluate(start[i], end[i], alpha[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, std::string("BezierBatch/") + bezier.first, ElementCount, [&]() {
+                curve.EvaluateBatch(start, end, alpha, out, ElementCount);
+                DoNotOptimize(out[0]);
+            });
+        }
+
+        const EasingCurve keys = EasingCurve::Keyframes({
+            { 0.0f, 0.0f, EasingFunctions::EASE_OUT_QUAD },
+            { 0.6f, 1.2f, EasingFunctions::EASE_IN_OUT_SINE },
+            { 1.0f, 1.0f, EasingFunctions::EASE_LINEAR } });
+
+        Run(options, results, "Keyframes/3", ElementCount, [&]() {
+            for (std::size_t i = 0; i < ElementCount; ++i) {
+                out[i] = keys.Evaluate(start[i], end[i], alpha[i]);
+            }
+            DoNotOptimize(out[0]);
+        });
+
+        const auto composed = EasingCompose::InOut(EasingCompose::Mirror(EasingCompose::Ease<EasingFunctions::EASE_OUT_BOUNCE>()));
+
+        Run(options, results, "Compose/InOutBounce", ElementCount, [&]() {
+            for (std::size_t i = 0; i < ElementCount; ++i) {
+                out[i] = composed.Evaluate(start[i], end[i], alpha[i]);
+            }
+            DoNotOptimize(out[0]);
+        });
+
+        const std::function<float(float)> outBounce = [](float a) { return EasingFunctions::Ease<EasingFunctions::EASE_OUT_BOUNCE>(0.0f, 1.0f, a); };
+        const std::function<float(float)> mirror = [&](float a) { return 1.0f - outBounce(1.0f - a); };
+        const std::function<float(float)> inOut = [&](float a) { return a < 0.5f ? mirror(a * 2.0f) * 0.5f : 1.0f - mirror(2.0f - a * 2.0f) * 0.5f; };
+
+        Run(options, results, "ComposeFunction/InOutBounce", ElementCount, [&]() {
+            for (std::size_t i = 0; i < ElementCount; ++i) {
+                out[i] = start[i] + (end[i] - start[i]) * inOut(alpha[i]);
+            }
+            DoNotOptimize(out[0]);
+        });
+    }
+
+    template<typename TFixed>
+    void RunFixedPointBenchmarks(const BenchOptions& options, const BenchData& data, const std::string& prefix, std::vector<BenchResult>& results)
+    {
+        std::vector<TFixed> start(ElementCount);
+        std::vector<TFixed> end(ElementCount);
+        std::vector<TFixed> alpha(ElementCount);
+        std::vector<TFixed> out(ElementCount);
+
+        for (std::size_t i = 0; i < ElementCount; ++i) {
+            start[i] = TFixed::FromDouble(data.Start[i]);
+            end[i] = TFixed::FromDouble(data.End[i]);
+            alpha[i] = TFixed::FromDouble(data.Alpha[i]);
+        }
+
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            volatile unsigned int opaqueType = type;
+            const EEaseType runtimeType = EEaseType(opaqueType);
+
+            Run(options, results, prefix + EaseNames[type], ElementCount, [&]() {
+                EasingFixedPoint::GetEaseFromTypeBatch(runtimeType, start.data(), end.data(), alpha.data(), out.data(), ElementCount);
+                DoNotOptimize(out[0]);
+            });
+        }
+    }
+
+    template<typename TStorage>
+    void RunPrecisionBenchmarks(const BenchOptions& options, const BenchData& data, const std::string& prefix, std::vector<BenchResult>& results)
+    {
+        typedef EasingPrecision<TStorage> Precision;
+        typedef typename Precision::Compute Compute;
+
+        std::vector<TStorage> start(ElementCount);
+        std::vector<TStorage> end(ElementCount);
+        std::vector<TStorage> alpha(ElementCount);
+        std::vector<TStorage> out(ElementCount);
+
+        for (std::size_t i = 0; i < ElementCount; ++i) {
+            start[i] = Precision::Narrow(Compute(data.Start[i]));
+            end[i] = Precision::Narrow(Compute(data.End[i]));
+            alpha[i] = Precision::Narrow(Compute(data.Alpha[i]));
+        }
+
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            volatile unsigned int opaqueType = type;
+            const EEaseType runtimeType = EEaseType(opaqueType);
+
+            Run(options, results, prefix + EaseNames[type], ElementCount, [&]() {
+                Precision::GetEaseFromTypeBatch(runtimeType, start.data(), end.data(), alpha.data(), out.data(), ElementCount);
+                DoNotOptimize(out[0]);
+            });
+        }
+    }
+
+    template<typename TStepper>
+    void RunStepperBenchmarks(const BenchOptions& options, const BenchData& data, const std::string& prefix, std::vector<BenchResult>& results)
+    {
+        std::vector<TStepper> steppers(ElementCount);
+        std::vector<float> out(ElementCount);
+
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            // Only the curves this stepper carries forward; the others would time GetEaseFromType again.
+            if (!TStepper(EEaseType(type), 0.0f, 1.0f, 1.0f, 1.0f).IsIncremental()) {
+                continue;
+            }
+
+            for (std::size_t i = 0; i < ElementCount; ++i) {
+                // Long enough that nothing finishes while the benchmark runs.
+                steppers[i].Reset(EEaseType(type), data.Start[i], data.End[i], 1e6f, 1.0f / 120.0f);
+            }
+
+            Run(options, results, prefix + EaseNames[type], ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = steppers[i].Next();
+                }
+                DoNotOptimize(out[0]);
+            });
+        }
+    }
+
+    void RunEnvelopeBenchmarks(const BenchOptions& options, std::vector<BenchResult>& results)
+    {
+        const std::size_t blockSize = 512;
+        std::vector<float> out(blockSize);
+
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            // A one second envelope at 48 kHz, rendered a block at a time from the middle of it.
+            const EasingEnvelope envelope(EEaseType(type), 1.0f, 0.0f, 48000.0);
+
+            Run(options, results, std::string("Envelope/") + EaseNames[type], blockSize, [&]() {
+                envelope.Render(20000.0, out.data(), blockSize);
+                DoNotOptimize(out[0]);
+            });
+        }
+    }
+
+    void RunDispatchBenchmarks(const BenchOptions& options, BenchData& data, std::vector<BenchResult>& results)
+    {
+        const float* start = data.Start.data();
+        const float* end = data.End.data();
+        const float* alpha = data.Alpha.data();
+        float* out = data.Out.data();
+
+        const std::pair<const char*, const std::vector<EEaseType>*> orders[] =
+        {
+            std::make_pair("Sorted", &data.SortedTypes),
+            std::make_pair("Shuffled", &data.ShuffledTypes)
+        };
+
+        for (const auto& order : orders) {
+            const EEaseType* types = order.second->data();
+
+            Run(options, results, std::string("Dispatch/Switch/") + order.first, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = EasingFunctions::GetEaseFromType(types[i], start[i], end[i], alpha[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+
+            Run(options, results, std::string("Dispatch/Pointer/") + order.first, ElementCount, [&]() {
+                for (std::size_t i = 0; i < ElementCount; ++i) {
+                    out[i] = EasingFunctions::GetEasingFunction(types[i])(start[i], end[i], alpha[i]);
+                }
+                DoNotOptimize(out[0]);
+            });
+        }
+    }
+
+    void RunTweenPoolBenchmarks(const BenchOptions& options, std::vector<BenchResult>& results)
+    {
+        const std::size_t counts[] = { 10000, 1000000 };
+
+        for (std::size_t count : counts) {
+            const std::string name = "TweenPool/Update/" + std::to_string(count);
+
+            // Filling a million tweens takes a while, so skip it when the benchmark is filtered out.
+            if (!IsSelected(options, name)) {
+                continue;
+            }
+
+            EasingTweenPool pool;
+            std::mt19937 generator(static_cast<unsigned int>(count));
+
+            for (std::size_t i = 0; i < count; ++i) {
+                // Durations long enough that nothing finishes while the benchmark runs.
+                pool.Add(EEaseType(generator() % EasingFunctions::EASE_TYPE_COUNT), 0.0f, 1.0f, 1e6f);
+            }
+
+            Run(options, results, name, count, [&]() {
+                pool.Update(1.0f / 120.0f);
+            });
+        }
+    }
+
+    void WriteJson(const BenchOptions& options, const std::vector<BenchResult>& results)
+    {
+        FILE* file = std::fopen(options.JsonPath.c_str(), "w");
+
+        if (file == nullptr) {
+            std::fprintf(stderr, "could not open %s\n", options.JsonPath.c_str());
+            return;
+        }
+
+        static const char* const SimdLevelNames[] = { "scalar", "sse2", "neon", "avx2", "avx512" };
+
+        std::fprintf(file, "{\n  \"context\": {\n");
+        std::fprintf(file, "    \"library\": \"easing\",\n");
+        std::fprintf(file, "    \"simd_level\": \"%s\",\n", SimdLevelNames[EasingFunctionsSimd::GetSimdLevel()]);
+#if defined(EASING_FAST_MATH)
+        std::fprintf(file, "    \"fast_math\": true,\n");
+#else
+        std::fprintf(file, "    \"fast_math\": false,\n");
+#endif
+        std::fprintf(file, "    \"elements_per_iteration\": %zu\n  },\n", ElementCount);
+        std::fprintf(file, "  \"benchmarks\": [\n");
+
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const BenchResult& result = results[i];
+
+            std::fprintf(file, "    {\"name\": \"%s\", \"iterations\": %zu, \"real_time\": %.6f, \"time_unit\": \"ns\", \"items_per_second\": %.1f}%s\n",
+                result.Name.c_str(), result.Iterations, result.NanosecondsPerItem, 1e9 / result.NanosecondsPerItem,
+                i + 1 < results.size() ? "," : "");
+        }
+
+        std::fprintf(file, "  ]\n}\n");
+        std::fclose(file);
+    }
+
+    bool ParseOption(const char* argument, const char* prefix, std::string& value)
+    {
+        const std::size_t length = std::strlen(prefix);
+
+        if (std::strncmp(argument, prefix, length) != 0) {
+            return false;
+        }
+
+        value = argument + length;
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string value;
+
+        if (ParseOption(argv[i], "--filter=", value)) {
+            options.Filter = value;
+        } else if (ParseOption(argv[i], "--min_time=", value)) {
+            options.MinTime = std::atof(value.c_str());
+        } else if (ParseOption(argv[i], "--json=", value)) {
+            options.JsonPath = value;
+        } else {
+            std::fprintf(stderr, "usage: %s [--filter=<substring>] [--min_time=<seconds>] [--json=<file>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    BenchData data;
+    std::mt19937 generator(42u);
+    std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+    std::uniform_real_distribution<float> range(-100.0f, 100.0f);
+
+    for (std::size_t i = 0; i < ElementCount; ++i) {
+        data.Start.push_back(range(generator));
+        data.End.push_back(range(generator));
+        data.Alpha.push_back(unit(generator));
+        data.SortedTypes.push_back(EEaseType(i * EasingFunctions::EASE_TYPE_COUNT / ElementCount));
+    }
+
+    data.Out.resize(ElementCount);
+    data.ShuffledTypes = data.SortedTypes;
+    std::shuffle(data.ShuffledTypes.begin(), data.ShuffledTypes.end(), generator);
+
+    std::vector<BenchResult> results;
+
+    RunCurveBenchmarks(options, data, results);
+    RunCustomCurveBenchmarks(options, data, results);
+    RunFixedPointBenchmarks<EasingQ16>(options, data, "FixedQ16/", results);
+    RunFixedPointBenchmarks<EasingQ32>(options, data, "FixedQ32/", results);
+    RunPrecisionBenchmarks<double>(options, data, "Double/", results);
+    RunPrecisionBenchmarks<EasingHalf>(options, data, "Half/", results);
+    RunPrecisionBenchmarks<EasingBFloat16>(options, data, "BFloat16/", results);
+    RunStepperBenchmarks<EasingPolynomialStepper>(options, data, "Stepper/", results);
+    RunStepperBenchmarks<EasingRecurrenceStepper>(options, data, "Recurrence/", results);
+    RunEnvelopeBenchmarks(options, results);
+    RunDispatchBenchmarks(options, data, results);
+    RunTweenPoolBenchmarks(options, results);
+
+    if (!options.JsonPath.empty()) {
+        WriteJson(options, results);
+    }
+
+    return 0;
+}
@@ -0,0 +1,358 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Curves built out of other curves, the way EaseInBounce is OutBounce played backwards and upside down, as expression
+ * templates. Every combinator returns a small value type that holds its operands by value, so a whole expression is a
+ * plain struct and the compiler inlines it into one kernel, with no allocation and no indirect call.
+ *
+ * typedef EasingCompose C;
+ *
+ * constexpr auto inOutBounce = C::InOut(C::Mirror(C::Ease<EasingFunctions::EASE_OUT_BOUNCE>()));
+ * const auto settle = C::Sequence(C::Ease<EasingFunctions::EASE_OUT_BACK>(), C::Ease<EasingFunctions::EASE_IN_OUT_SINE>(), 0.6f, 0.8f);
+ * const auto delayed = C::Retime(C::Blend(settle, C::Ease<EasingFunctions::EASE_OUT_QUAD>(), 0.25f), 1.25f, -0.25f);
+ *
+ * float value = delayed.Evaluate(0.0f, 10.0f, 0.67f);
+ * float speed = delayed.EvaluateDerivative(0.0f, 10.0f, 0.67f);
+ * delayed.EvaluateBatch(start, end, alpha, out, count);
+ *
+ * The combinators work on the normalized curve (start = 0, end = 1):
+ *
+ *   Ease<E>()                  a preset, through EasingFunctions::Ease<E>, so the switch folds away
+ *   Ease(easeType)             a preset picked at runtime, one GetEaseFromType switch per evaluation
+ *   Reverse(c)                 c played backwards: c(1 - alpha), from 1 to 0
+ *   Mirror(c)                  c flipped on both axes, 1 - c(1 - alpha), which turns an In curve into its Out curve
+ *   InOut(c)                   c over the first half and Mirror(c) over the second, as the EaseInOut* curves do
+ *   Sequence(a, b, at, value)  a from 0 to value over [0, at], then b from value to 1 over [at, 1]
+ *   Blend(a, b, weight)        a + (b - a) * weight
+ *   Retime(c, scale, offset)   c(alpha * scale + offset), with the remapped alpha clamped to [0, 1]
+ *
+ * Derivatives follow by the chain rule, so EvaluateDerivative is exact wherever the operands are. Every node is a
+ * literal type; an expression made only of the algebraic presets (Quad to Quint, Bounce and Back) evaluates in a
+ * constant expression from C++14, and the rest from C++17 like EasingFunctions::Ease.
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+
+#include <cstddef>
+
+class EasingCompose
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    //
+    // Shared by every node: the curve over a start..end range, and a batch over arrays. TExpression provides
+    // Value(alpha) and Slope(alpha) on the normalized curve.
+    //
+    template<typename TExpression>
+    struct Expression
+    {
+        template<typename T>
+        constexpr T Evaluate(T start, T end, T alpha) const
+        {
+            return start + (end - start) * Self().Value(alpha);
+        }
+
+        template<typename T>
+        constexpr T EvaluateDerivative(T start, T end, T alpha) const
+        {
+            return (end - start) * Self().Slope(alpha);
+        }
+
+        template<typename T>
+        constexpr T operator()(T start, T end, T alpha) const
+        {
+            return Evaluate(start, end, alpha);
+        }
+
+        //
+        // start, end, alpha and out must each point to at least `count` elements. out may alias any of the inputs.
+        //
+        template<typename T>
+        void EvaluateBatch(const T* start, const T* end, const T* alpha, T* out, std::size_t count) const
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = Evaluate(start[i], end[i], alpha[i]);
+            }
+        }
+
+    private:
+        constexpr const TExpression& Self() const
+        {
+            return static_cast<const TExpression&>(*this);
+        }
+    };
+
+    template<EEaseType EaseType>
+    struct PresetNode : Expression<PresetNode<EaseType>>
+    {
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            return EasingFunctions::Ease<EaseType>(T(0.0f), T(1.0f), alpha);
+        }
+
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            return EasingFunctions::EaseDerivative<EaseType>(T(0.0f), T(1.0f), alpha);
+        }
+    };
+
+    struct RuntimePresetNode : Expression<RuntimePresetNode>
+    {
+        constexpr explicit RuntimePresetNode(EEaseType easeType)
+            : EaseType(easeType)
+        {
+        }
+
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            return EasingFunctions::GetEaseFromType(EaseType, T(0.0f), T(1.0f), alpha);
+        }
+
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            return EasingFunctions::GetEaseDerivativeFromType(EaseType, T(0.0f), T(1.0f), alpha);
+        }
+
+        EEaseType EaseType;
+    };
+
+    template<typename TCurve>
+    struct ReverseNode : Expression<ReverseNode<TCurve>>
+    {
+        constexpr explicit ReverseNode(const TCurve& curve)
+            : Curve(curve)
+        {
+        }
+
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            return Curve.Value(T(1.0f) - alpha);
+        }
+
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            return -Curve.Slope(T(1.0f) - alpha);
+        }
+
+        TCurve Curve;
+    };
+
+    template<typename TCurve>
+    struct MirrorNode : Expression<MirrorNode<TCurve>>
+    {
+        constexpr explicit MirrorNode(const TCurve& curve)
+            : Curve(curve)
+        {
+        }
+
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            return T(1.0f) - Curve.Value(T(1.0f) - alpha);
+        }
+
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            return Curve.Slope(T(1.0f) - alpha);
+        }
+
+        TCurve Curve;
+    };
+
+    template<typename TCurve>
+    struct InOutNode : Expression<InOutNode<TCurve>>
+    {
+        constexpr explicit InOutNode(const TCurve& curve)
+            : Curve(curve)
+        {
+        }
+
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            return alpha < T(0.5f)
+                ? Curve.Value(alpha * T(2.0f)) * T(0.5f)
+                : T(1.0f) - Curve.Value(T(2.0f) - alpha * T(2.0f)) * T(0.5f);
+        }
+
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            return alpha < T(0.5f) ? Curve.Slope(alpha * T(2.0f)) : Curve.Slope(T(2.0f) - alpha * T(2.0f));
+        }
+
+        TCurve Curve;
+    };
+
+    template<typename TFirst, typename TSecond>
+    struct SequenceNode : Expression<SequenceNode<TFirst, TSecond>>
+    {
+        constexpr SequenceNode(const TFirst& first, const TSecond& second, float at, float value)
+            : First(first)
+            , Second(second)
+            , At(at)
+            , AtValue(value)
+        {
+        }
+
+        //
+        // At 1 the second curve never plays, and alpha 1 stays on the end of the first.
+        //
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            return alpha < T(At) || At >= 1.0f
+                ? T(AtValue) * First.Value(alpha / T(At))
+                : T(AtValue) + T(1.0f - AtValue) * Second.Value((alpha - T(At)) / T(1.0f - At));
+        }
+
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            return alpha < T(At) || At >= 1.0f
+                ? T(AtValue) * First.Slope(alpha / T(At)) / T(At)
+                : T(1.0f - AtValue) * Second.Slope((alpha - T(At)) / T(1.0f - At)) / T(1.0f - At);
+        }
+
+        TFirst First;
+        TSecond Second;
+        float At;
+        float AtValue;
+    };
+
+    template<typename TFirst, typename TSecond>
+    struct BlendNode : Expression<BlendNode<TFirst, TSecond>>
+    {
+        constexpr BlendNode(const TFirst& first, const TSecond& second, float weight)
+            : First(first)
+            , Second(second)
+            , Weight(weight)
+        {
+        }
+
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            const T first = First.Value(alpha);
+            return first + (Second.Value(alpha) - first) * T(Weight);
+        }
+
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            const T first = First.Slope(alpha);
+            return first + (Second.Slope(alpha) - first) * T(Weight);
+        }
+
+        TFirst First;
+        TSecond Second;
+        float Weight;
+    };
+
+    template<typename TCurve>
+    struct RetimeNode : Expression<RetimeNode<TCurve>>
+    {
+        constexpr RetimeNode(const TCurve& curve, float scale, float offset)
+            : Curve(curve)
+            , Scale(scale)
+            , Offset(offset)
+        {
+        }
+
+        template<typename T>
+        constexpr T Value(T alpha) const
+        {
+            return Curve.Value(Clamp(alpha * T(Scale) + T(Offset)));
+        }
+
+        //
+        // 0 where the remapped alpha is clamped, since the curve holds its end value there.
+        //
+        template<typename T>
+        constexpr T Slope(T alpha) const
+        {
+            const T remapped = alpha * T(Scale) + T(Offset);
+            return remapped >= T(0.0f) && remapped <= T(1.0f) ? Curve.Slope(remapped) * T(Scale) : T(0.0f);
+        }
+
+        TCurve Curve;
+        float Scale;
+        float Offset;
+
+    private:
+        template<typename T>
+        static constexpr T Clamp(T alpha)
+        {
+            return alpha < T(0.0f) ? T(0.0f) : (alpha > T(1.0f) ? T(1.0f) : alpha);
+        }
+    };
+
+    template<EEaseType EaseType>
+    static constexpr PresetNode<EaseType> Ease()
+    {
+        return PresetNode<EaseType>();
+    }
+
+    static constexpr RuntimePresetNode Ease(EEaseType easeType)
+    {
+        return RuntimePresetNode(easeType);
+    }
+
+    template<typename TCurve>
+    static constexpr ReverseNode<TCurve> Reverse(const Expression<TCurve>& curve)
+    {
+        return ReverseNode<TCurve>(static_cast<const TCurve&>(curve));
+    }
+
+    template<typename TCurve>
+    static constexpr MirrorNode<TCurve> Mirror(const Expression<TCurve>& curve)
+    {
+        return MirrorNode<TCurve>(static_cast<const TCurve&>(curve));
+    }
+
+    template<typename TCurve>
+    static constexpr InOutNode<TCurve> InOut(const Expression<TCurve>& curve)
+    {
+        return InOutNode<TCurve>(static_cast<const TCurve&>(curve));
+    }
+
+    //
+    // `at` in (0, 1]; `value` is where the first curve hands over, in normalized units.
+    //
+    template<typename TFirst, typename TSecond>
+    static constexpr SequenceNode<TFirst, TSecond> Sequence(const Expression<TFirst>& first, const Expression<TSecond>& second,
+        float at, float value)
+    {
+        return SequenceNode<TFirst, TSecond>(static_cast<const TFirst&>(first), static_cast<const TSecond&>(second), at, value);
+    }
+
+    template<typename TFirst, typename TSecond>
+    static constexpr BlendNode<TFirst, TSecond> Blend(const Expression<TFirst>& first, const Expression<TSecond>& second, float weight)
+    {
+        return BlendNode<TFirst, TSecond>(static_cast<const TFirst&>(first), static_cast<const TSecond&>(second), weight);
+    }
+
+    //
+    // Retime(c, 1 / length, -delay / length) waits `delay`, plays c over `length`, and holds 1 afterwards.
+    //
+    template<typename TCurve>
+    static constexpr RetimeNode<TCurve> Retime(const Expression<TCurve>& curve, float scale, float offset)
+    {
+        return RetimeNode<TCurve>(static_cast<const TCurve&>(curve), scale, offset);
+    }
+};
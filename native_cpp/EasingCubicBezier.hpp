@@ -0,0 +1,304 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * CSS style cubic-bezier(x1, y1, x2, y2) timing curves. The curve runs from (0, 0) to (1, 1) through the two control
+ * points; alpha is the x axis and the eased value is the y axis, so evaluating it means solving x(t) = alpha for the
+ * curve parameter t and returning y(t).
+ *
+ * static const EasingCubicBezier ease(0.25f, 0.1f, 0.25f, 1.0f);
+ *
+ * float value = ease.Evaluate(0, 10, 0.67f);
+ *
+ * The solve starts from a seed cached at construction: x is split into SeedCount intervals, and at each knot the
+ * constructor stores t and the first two derivatives of x(t). The seed is the root of the quadratic Taylor expansion
+ * around the nearest knot, which already follows the t ~ sqrt(x) shape near an end whose control point sits on the
+ * x axis. One Halley step takes it to float precision. The common curves (ease, ease-in, ease-out, ease-in-out) stay
+ * within 1e-6 of the exact value. If the x residual is still above SolveTolerance, the solve falls back to bisection
+ * between the two knots. That only happens where x'(t) nearly vanishes inside the curve, such as (1, 0, 0, 1).
+ *
+ * x1 and x2 are clamped to [0, 1] so x(t) is monotonic, as CSS requires. y1 and y2 are free, so the curve can
+ * overshoot like EASE_OUT_BACK. Alpha is clamped to [0, 1], and alpha 0 and 1 give exactly start and end.
+ *
+ * EasingCurve wraps this next to the EEaseType presets and keyframes. EasingFunctionsSimd::GetCubicBezierBatch
+ * evaluates whole arrays.
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+class EasingCubicBezier
+{
+public:
+    static const std::size_t SeedCount = 16;
+
+    //
+    // Largest x residual accepted from the seeded Halley step before falling back to bisection, a few float roundings
+    // of x(t).
+    //
+    static constexpr float SolveTolerance = 1e-6f;
+
+    //
+    // The linear curve: control points on the diagonal at thirds make x(t) = t exactly.
+    //
+    constexpr EasingCubicBezier()
+        : EasingCubicBezier(1.0f / 3.0f, 1.0f / 3.0f, 2.0f / 3.0f, 2.0f / 3.0f)
+    {
+    }
+
+    constexpr EasingCubicBezier(float x1, float y1, float x2, float y2)
+        : X1(Clamp(x1))
+        , Y1(y1)
+        , X2(Clamp(x2))
+        , Y2(y2)
+        , Ax(0.0f)
+        , Bx(0.0f)
+        , Cx(0.0f)
+        , Ay(0.0f)
+        , By(0.0f)
+        , Cy(0.0f)
+        , SeedAlphas()
+        , SeedSlopes()
+        , SeedCurvatures()
+    {
+        // Power basis of B(t) = 3(1 - t)^2 t P1 + 3(1 - t) t^2 P2 + t^3, evaluated as ((A t + B) t + C) t.
+        Cx = 3.0f * X1;
+        Bx = 3.0f * (X2 - X1) - Cx;
+        Ax = 1.0f - Cx - Bx;
+
+        Cy = 3.0f * Y1;
+        By = 3.0f * (Y2 - Y1) - Cy;
+        Ay = 1.0f - Cy - By;
+
+        for (std::size_t i = 0; i <= SeedCount; ++i) {
+            const double x = double(i) / double(SeedCount);
+            double lo = 0.0;
+            double hi = 1.0;
+
+            // Bisection in double, so every seed is exact to float precision whatever the curve looks like there.
+            for (int iteration = 0; iteration < 60; ++iteration) {
+                const double middle = 0.5 * (lo + hi);
+
+                if (((double(Ax) * middle + double(Bx)) * middle + double(Cx)) * middle < x) {
+                    lo = middle;
+                } else {
+                    hi = middle;
+                }
+            }
+
+            const double t = 0.5 * (lo + hi);
+
+            SeedAlphas[i] = float(t);
+            SeedSlopes[i] = float((3.0 * double(Ax) * t + 2.0 * double(Bx)) * t + double(Cx));
+            SeedCurvatures[i] = float(3.0 * double(Ax) * t + double(Bx));
+        }
+    }
+
+    constexpr float Evaluate(float start, float end, float alpha) const
+    {
+        return start + (end - start) * Sample(alpha);
+    }
+
+    //
+    // Per normalized alpha, like the *D functions: (end - start) * y'(t) / x'(t).
+    //
+    constexpr float EvaluateDerivative(float start, float end, float alpha) const
+    {
+        return (end - start) * SampleDerivative(alpha);
+    }
+
+    //
+    // Value, velocity and acceleration from one solve, see EasingFunctions::GetEaseWithVelocityFromType.
+    //
+    constexpr EasingFunctions::EaseSample<float> EvaluateWithVelocity(float start, float end, float alpha) const
+    {
+        const float x = Clamp(alpha);
+        const float t = Solve(x);
+
+        const float slopeX = SlopeX(t);
+        const float slopeY = SlopeY(t);
+        const float velocity = Velocity(t, slopeX, slopeY);
+
+        // d2y/dx2 = (y'' x' - y' x'') / x'^3. Left at 0 where x' vanishes, which is only ever a single point.
+        const float acceleration = slopeX != 0.0f
+            ? (CurvatureY(t) * slopeX - slopeY * CurvatureX(t)) / (slopeX * slopeX * slopeX)
+            : 0.0f;
+
+        return { start + (end - start) * (x < 1.0f ? CurveY(t) : 1.0f), (end - start) * velocity, (end - start) * acceleration };
+    }
+
+    //
+    // The normalized curve (start = 0, end = 1) at alpha, and its slope.
+    //
+    constexpr float Sample(float alpha) const
+    {
+        const float x = Clamp(alpha);
+        return x < 1.0f ? CurveY(Solve(x)) : 1.0f;
+    }
+
+    constexpr float SampleDerivative(float alpha) const
+    {
+        const float t = Solve(Clamp(alpha));
+        return Velocity(t, SlopeX(t), SlopeY(t));
+    }
+
+    //
+    // The curve parameter t at which x(t) = x, for x in [0, 1].
+    //
+    constexpr float Solve(float x) const
+    {
+        // The seed needs sqrt, which is not constexpr; the compiler can afford the bisection.
+        if (EASING_IS_CONSTANT_EVALUATED()) {
+            return Bisect(x);
+        }
+
+        const std::size_t knot = std::size_t(x * float(SeedCount) + 0.5f);
+        const float t = Refine(x, Seed(x - float(knot) * (1.0f / float(SeedCount)), knot));
+
+        return Abs(CurveX(t) - x) <= SolveTolerance ? t : Bisect(x);
+    }
+
+    //
+    // True if the curve goes vertical somewhere, where x'(t) touches 0 but y'(t) does not. EasingCurveTable falls back
+    // to a finite difference there, as it does for the Circ curves.
+    //
+    constexpr bool HasVerticalTangent() const
+    {
+        const float epsilon = 1e-6f;
+
+        if ((SlopeX(0.0f) <= epsilon && SlopeY(0.0f) != 0.0f) || (SlopeX(1.0f) <= epsilon && SlopeY(1.0f) != 0.0f)) {
+            return true;
+        }
+
+        // x'(t) is a quadratic that stays >= 0 for x1, x2 in [0, 1]; check its minimum inside the curve.
+        if (Ax > 0.0f) {
+            const float vertex = -Bx / (3.0f * Ax);
+            return vertex > 0.0f && vertex < 1.0f && SlopeX(vertex) <= epsilon;
+        }
+
+        return false;
+    }
+
+    constexpr float GetX1() const { return X1; }
+    constexpr float GetY1() const { return Y1; }
+    constexpr float GetX2() const { return X2; }
+    constexpr float GetY2() const { return Y2; }
+
+private:
+    friend class EasingFunctionsSimd;
+
+    static constexpr float MinDenominator = 1e-12f;
+
+    static constexpr float Clamp(float alpha)
+    {
+        // NaN goes to 0 so it can never index the seeds.
+        return alpha > 0.0f ? (alpha < 1.0f ? alpha : 1.0f) : 0.0f;
+    }
+
+    static constexpr float Abs(float x)
+    {
+        return x < 0.0f ? -x : x;
+    }
+
+    static constexpr float Max(float a, float b)
+    {
+        return a > b ? a : b;
+    }
+
+    constexpr float CurveX(float t) const { return ((Ax * t + Bx) * t + Cx) * t; }
+    constexpr float CurveY(float t) const { return ((Ay * t + By) * t + Cy) * t; }
+    constexpr float SlopeX(float t) const { return (3.0f * Ax * t + 2.0f * Bx) * t + Cx; }
+    constexpr float SlopeY(float t) const { return (3.0f * Ay * t + 2.0f * By) * t + Cy; }
+    constexpr float CurvatureX(float t) const { return 6.0f * Ax * t + 2.0f * Bx; }
+    constexpr float CurvatureY(float t) const { return 6.0f * Ay * t + 2.0f * By; }
+
+    constexpr float Velocity(float t, float slopeX, float slopeY) const
+    {
+        if (slopeX != 0.0f || slopeY != 0.0f) {
+            return slopeY / slopeX;
+        }
+
+        // Both slopes vanish at an end whose control point coincides with it; the tangent is the ratio of the second
+        // derivatives there (l'Hopital).
+        const float curvatureX = CurvatureX(t);
+        return curvatureX != 0.0f ? CurvatureY(t) / curvatureX : 0.0f;
+    }
+
+    //
+    // Root of the Taylor expansion of x(t) around a knot, curvature * d^2 + slope * d = offset, nearest to the knot.
+    // Written as 2 * offset / (slope + sqrt(...)) so it stays finite where the slope is 0.
+    //
+    float Seed(float offset, std::size_t knot) const
+    {
+        const float slope = SeedSlopes[knot];
+        const float discriminant = slope * slope + 4.0f * SeedCurvatures[knot] * offset;
+        const float denominator = slope + std::sqrt(Max(discriminant, 0.0f));
+
+        return SeedAlphas[knot] + 2.0f * offset / Max(denominator, MinDenominator);
+    }
+
+    //
+    // One Halley step on x(t) - x, clamped to the curve.
+    //
+    constexpr float Refine(float x, float t) const
+    {
+        const float residual = CurveX(t) - x;
+        const float slope = SlopeX(t);
+        const float denominator = slope * slope - 0.5f * residual * CurvatureX(t);
+        const float next = t - residual * slope / Max(denominator, MinDenominator);
+
+        return next > 0.0f ? (next < 1.0f ? next : 1.0f) : 0.0f;
+    }
+
+    //
+    // Bisection between the two knots around x, which always bracket the root since x(t) is monotonic.
+    //
+    constexpr float Bisect(float x) const
+    {
+        const std::size_t knot = std::size_t(x * float(SeedCount));
+        const std::size_t index = knot < SeedCount ? knot : SeedCount - 1;
+
+        float lo = SeedAlphas[index];
+        float hi = SeedAlphas[index + 1];
+
+        for (int iteration = 0; iteration < 32; ++iteration) {
+            const float middle = 0.5f * (lo + hi);
+
+            if (middle <= lo || middle >= hi) {
+                break;
+            }
+
+            if (CurveX(middle) < x) {
+                lo = middle;
+            } else {
+                hi = middle;
+            }
+        }
+
+        return 0.5f * (lo + hi);
+    }
+
+    float X1;
+    float Y1;
+    float X2;
+    float Y2;
+
+    float Ax;
+    float Bx;
+    float Cx;
+    float Ay;
+    float By;
+    float Cy;
+
+    float SeedAlphas[SeedCount + 1];
+    float SeedSlopes[SeedCount + 1];
+    float SeedCurvatures[SeedCount + 1];
+};
@@ -0,0 +1,361 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * One value type for every kind of curve: an EEaseType preset, a CSS style cubic-bezier, or a keyframe curve. Code
+ * that takes an EasingCurve accepts any of the three through the same calls, and an EEaseType converts to it
+ * implicitly, so existing call sites keep working.
+ *
+ * EasingCurve bounce = EasingFunctions::EASE_OUT_BOUNCE;
+ * EasingCurve ease = EasingCurve::CubicBezier(0.25f, 0.1f, 0.25f, 1.0f);
+ * EasingCurve keys = EasingCurve::Keyframes({
+ *     { 0.0f, 0.0f, EasingFunctions::EASE_OUT_QUAD },
+ *     { 0.6f, 1.2f, EasingFunctions::EASE_IN_OUT_SINE },
+ *     { 1.0f, 1.0f, EasingFunctions::EASE_LINEAR } });
+ *
+ * float value = ease.Evaluate(0.0f, 10.0f, 0.67f);
+ * float speed = keys.EvaluateDerivative(0.0f, 10.0f, 0.67f);
+ * ease.EvaluateBatch(start, end, alpha, out, count);
+ *
+ * static EasingCurveTable<1024> baked(ease, EASE_TABLE_HERMITE);
+ *
+ * Presets forward to GetEaseFromType and the rest of EasingFunctions, so they give exactly the same values. Batches of
+ * presets and beziers go through EasingFunctionsSimd. EasingCurveTable and EasingIntegralTable bake any EasingCurve.
+ *
+ * A keyframe holds an alpha, a normalized value (0 maps to start and 1 to end), and the preset that eases from it to
+ * the next key. Keys must be sorted by alpha. Before the first key and after the last one the curve holds their
+ * value; two keys at the same alpha make a jump. Up to MaxKeyframes keys are stored inline, so an EasingCurve never
+ * allocates and can be built at compile time (C++17 for the beziers). The bezier and the keys share their storage,
+ * so a curve is the size of the larger of the two, not of both.
+ */
+
+#pragma once
+
+#include "EasingCubicBezier.hpp"
+#include "EasingFunctions.hpp"
+#include "EasingFunctionsSimd.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+
+enum EEaseCurveKind : unsigned int
+{
+    EASE_CURVE_PRESET = 0,
+    EASE_CURVE_CUBIC_BEZIER,
+    EASE_CURVE_KEYFRAMES
+};
+
+struct EasingKeyframe
+{
+    float Alpha;
+    float Value;
+    EasingFunctions::EEaseType EaseType;
+};
+
+class EasingCurve
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    static const std::size_t MaxKeyframes = 16;
+
+    constexpr EasingCurve()
+        : EasingCurve(EasingFunctions::EASE_LINEAR)
+    {
+    }
+
+    constexpr EasingCurve(EEaseType easeType)
+        : Kind(EASE_CURVE_PRESET)
+        , EaseType(easeType)
+        , Preset()
+    {
+    }
+
+    constexpr EasingCurve(const EasingCubicBezier& bezier)
+        : Kind(EASE_CURVE_CUBIC_BEZIER)
+        , EaseType(EasingFunctions::EASE_LINEAR)
+        , Bezier(bezier)
+    {
+    }
+
+    static constexpr EasingCurve CubicBezier(float x1, float y1, float x2, float y2)
+    {
+        return EasingCurve(EasingCubicBezier(x1, y1, x2, y2));
+    }
+
+    //
+    // At most MaxKeyframes keys: more fail the assert (and a compile time curve fails to compile), and without asserts
+    // the keys past MaxKeyframes are dropped. No keys at all gives EASE_LINEAR.
+    //
+    static constexpr EasingCurve Keyframes(const EasingKeyframe* keys, std::size_t count)
+    {
+        assert(count <= MaxKeyframes && "EasingCurve::Keyframes takes at most MaxKeyframes keys");
+
+        return count > 0 ? EasingCurve(keys, count) : EasingCurve();
+    }
+
+    static constexpr EasingCurve Keyframes(std::initializer_list<EasingKeyframe> keys)
+    {
+        return Keyframes(keys.begin(), keys.size());
+    }
+
+    template<typename T>
+    constexpr T Evaluate(T start, T end, T alpha) const
+    {
+        return Kind == EASE_CURVE_PRESET
+            ? EasingFunctions::GetEaseFromType(EaseType, start, end, alpha)
+            : start + (end - start) * Sample(alpha);
+    }
+
+    template<typename T>
+    constexpr T EvaluateDerivative(T start, T end, T alpha) const
+    {
+        return Kind == EASE_CURVE_PRESET
+            ? EasingFunctions::GetEaseDerivativeFromType(EaseType, start, end, alpha)
+            : (end - start) * SampleDerivative(alpha);
+    }
+
+    //
+    // See EasingFunctions::GetEaseWithVelocityFromType. Keyframes return the values of the segment alpha falls in.
+    //
+    template<typename T>
+    constexpr EasingFunctions::EaseSample<T> EvaluateWithVelocity(T start, T end, T alpha) const
+    {
+        switch (Kind)
+        {
+            default:
+                return EasingFunctions::GetEaseWithVelocityFromType(EaseType, start, end, alpha);
+
+            case EASE_CURVE_CUBIC_BEZIER:
+            {
+                const EasingFunctions::EaseSample<float> sample = Bezier.EvaluateWithVelocity(float(start), float(end), float(alpha));
+                return { T(sample.Value), T(sample.Velocity), T(sample.Acceleration) };
+            }
+
+            case EASE_CURVE_KEYFRAMES:
+            {
+                std::size_t key = 0;
+                T u = T(0.0f);
+
+                if (!LocateKey(alpha, key, u)) {
+                    return { start + (end - start) * T(KeyList.Keys[key].Value), T(0.0f), T(0.0f) };
+                }
+
+                // Chain rule through u = (alpha - a0) / (a1 - a0).
+                const T scale = T(1.0f) / T(KeyList.Keys[key + 1].Alpha - KeyList.Keys[key].Alpha);
+                const EasingFunctions::EaseSample<T> sample = EasingFunctions::GetEaseWithVelocityFromType(
+                    KeyList.Keys[key].EaseType, T(KeyList.Keys[key].Value), T(KeyList.Keys[key + 1].Value), u);
+
+                return { start + (end - start) * sample.Value, (end - start) * sample.Velocity * scale,
+                    (end - start) * sample.Acceleration * scale * scale };
+            }
+        }
+    }
+
+    //
+    // start, end, alpha and out must each point to at least `count` elements. out may alias any of the inputs.
+    //
+    void EvaluateBatch(const float* start, const float* end, const float* alpha, float* out, std::size_t count) const
+    {
+        switch (Kind)
+        {
+            default:
+                return EasingFunctionsSimd::GetEaseFromTypeBatch(EaseType, start, end, alpha, out, count);
+
+            case EASE_CURVE_CUBIC_BEZIER:
+                return EasingFunctionsSimd::GetCubicBezierBatch(Bezier, start, end, alpha, out, count);
+
+            case EASE_CURVE_KEYFRAMES:
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = start[i] + (end[i] - start[i]) * SampleKeyframes(alpha[i]);
+                }
+                return;
+        }
+    }
+
+    void EvaluateDerivativeBatch(const float* start, const float* end, const float* alpha, float* out, std::size_t count) const
+    {
+        if (Kind == EASE_CURVE_PRESET) {
+            return EasingFunctions::GetEaseDerivativeFromTypeBatch(EaseType, start, end, alpha, out, count);
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = (end[i] - start[i]) * SampleDerivative(alpha[i]);
+        }
+    }
+
+    //
+    // The normalized curve (start = 0, end = 1) at alpha, and its slope. Beziers are solved in float whatever T is.
+    //
+    template<typename T>
+    constexpr T Sample(T alpha) const
+    {
+        switch (Kind)
+        {
+            default:
+                return EasingFunctions::GetEaseFromType(EaseType, T(0.0f), T(1.0f), alpha);
+
+            case EASE_CURVE_CUBIC_BEZIER:
+                return T(Bezier.Sample(float(alpha)));
+
+            case EASE_CURVE_KEYFRAMES:
+                return SampleKeyframes(alpha);
+        }
+    }
+
+    template<typename T>
+    constexpr T SampleDerivative(T alpha) const
+    {
+        switch (Kind)
+        {
+            default:
+                return EasingFunctions::GetEaseDerivativeFromType(EaseType, T(0.0f), T(1.0f), alpha);
+
+            case EASE_CURVE_CUBIC_BEZIER:
+                return T(Bezier.SampleDerivative(float(alpha)));
+
+            case EASE_CURVE_KEYFRAMES:
+            {
+                std::size_t key = 0;
+                T u = T(0.0f);
+
+                if (!LocateKey(alpha, key, u)) {
+                    return T(0.0f);
+                }
+
+                return EasingFunctions::GetEaseDerivativeFromType(KeyList.Keys[key].EaseType, T(KeyList.Keys[key].Value), T(KeyList.Keys[key + 1].Value), u)
+                    / T(KeyList.Keys[key + 1].Alpha - KeyList.Keys[key].Alpha);
+            }
+        }
+    }
+
+    //
+    // Whether the slope goes infinite somewhere: the Circ presets, keyframes with a Circ segment, and beziers whose
+    // x'(t) touches 0 while y'(t) does not.
+    //
+    constexpr bool HasVerticalTangent() const
+    {
+        switch (Kind)
+        {
+            default:
+                return IsCirc(EaseType);
+
+            case EASE_CURVE_CUBIC_BEZIER:
+                return Bezier.HasVerticalTangent();
+
+            case EASE_CURVE_KEYFRAMES:
+                for (std::size_t i = 0; i + 1 < KeyList.Count; ++i) {
+                    if (IsCirc(KeyList.Keys[i].EaseType)) {
+                        return true;
+                    }
+                }
+                return false;
+        }
+    }
+
+    constexpr EEaseCurveKind GetKind() const { return Kind; }
+
+    //
+    // The preset, or EASE_LINEAR for the other kinds. The bezier, or the linear one for the other kinds. Keyframes are
+    // only there for EASE_CURVE_KEYFRAMES, and GetKeyframe asserts on any other kind or an index past the count.
+    //
+    constexpr EEaseType GetEaseType() const { return EaseType; }
+    constexpr EasingCubicBezier GetCubicBezier() const { return Kind == EASE_CURVE_CUBIC_BEZIER ? Bezier : EasingCubicBezier(); }
+    constexpr std::size_t GetKeyframeCount() const { return Kind == EASE_CURVE_KEYFRAMES ? KeyList.Count : 0; }
+
+    constexpr const EasingKeyframe& GetKeyframe(std::size_t index) const
+    {
+        assert(Kind == EASE_CURVE_KEYFRAMES && index < KeyList.Count && "EasingCurve::GetKeyframe has no such keyframe");
+
+        return KeyList.Keys[index];
+    }
+
+private:
+    struct KeyframeList
+    {
+        EasingKeyframe Keys[MaxKeyframes];
+        std::size_t Count;
+    };
+
+    struct NoShape
+    {
+    };
+
+    constexpr EasingCurve(const EasingKeyframe* keys, std::size_t count)
+        : Kind(EASE_CURVE_KEYFRAMES)
+        , EaseType(EasingFunctions::EASE_LINEAR)
+        , KeyList()
+    {
+        KeyList.Count = count < MaxKeyframes ? count : MaxKeyframes;
+
+        for (std::size_t i = 0; i < KeyList.Count; ++i) {
+            KeyList.Keys[i] = keys[i];
+        }
+    }
+
+    static constexpr bool IsCirc(EEaseType easeType)
+    {
+        return easeType == EasingFunctions::EASE_IN_CIRC || easeType == EasingFunctions::EASE_OUT_CIRC
+            || easeType == EasingFunctions::EASE_IN_OUT_CIRC;
+    }
+
+    //
+    // Finds the segment alpha falls in, as the index of its first key and the normalized position u inside it. Returns
+    // false outside the keys, with `key` set to the key whose value holds there.
+    //
+    template<typename T>
+    constexpr bool LocateKey(T alpha, std::size_t& key, T& u) const
+    {
+        if (!(alpha >= T(KeyList.Keys[0].Alpha))) {
+            key = 0;
+            return false;
+        }
+
+        // At most MaxKeyframes keys, so a plain scan is as quick as a binary search.
+        std::size_t last = 0;
+
+        for (std::size_t i = 1; i < KeyList.Count; ++i) {
+            if (T(KeyList.Keys[i].Alpha) <= alpha) {
+                last = i;
+            }
+        }
+
+        key = last;
+
+        if (last + 1 >= KeyList.Count) {
+            return false;
+        }
+
+        u = (alpha - T(KeyList.Keys[last].Alpha)) / T(KeyList.Keys[last + 1].Alpha - KeyList.Keys[last].Alpha);
+        return true;
+    }
+
+    template<typename T>
+    constexpr T SampleKeyframes(T alpha) const
+    {
+        std::size_t key = 0;
+        T u = T(0.0f);
+
+        if (!LocateKey(alpha, key, u)) {
+            return T(KeyList.Keys[key].Value);
+        }
+
+        return EasingFunctions::GetEaseFromType(KeyList.Keys[key].EaseType, T(KeyList.Keys[key].Value), T(KeyList.Keys[key + 1].Value), u);
+    }
+
+    EEaseCurveKind Kind;
+    EEaseType EaseType;
+
+    // Only the member Kind names is live.
+    union
+    {
+        NoShape Preset;
+        EasingCubicBezier Bezier;
+        KeyframeList KeyList;
+    };
+};
@@ -0,0 +1,210 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Baked version of a curve from EasingFunctions.hpp, or any EasingCurve. The normalized curve (start = 0, end = 1) is
+ * sampled once into a table of Resolution + 1 points and then evaluated with linear or cubic Hermite interpolation,
+ * which is a couple of loads and multiplies no matter how expensive the original curve is.
+ *
+ * static EasingCurveTable<1024> elastic(EasingFunctions::EASE_IN_OUT_ELASTIC, EASE_TABLE_HERMITE);
+ *
+ * float value = elastic.Evaluate(0, 10, 0.67f);
+ *
+ * Alpha is clamped to [0, 1]. Both arrays are cache line aligned; the table itself lives wherever the object does, so
+ * a static or member table needs no allocation at all. Baking is constexpr too (C++17), so a table can be built by the
+ * compiler and placed in read-only data with no startup cost:
+ *
+ * static constexpr EasingCurveTable<256> bounce(EasingFunctions::EASE_OUT_BOUNCE, EASE_TABLE_HERMITE);
+ *
+ * Maximum absolute error against the direct curve over [0, 1] (start = 0, end = 1), as reported by MeasureMaxError:
+ *
+ *                              256 linear   256 hermite  1024 linear  1024 hermite  4096 linear  4096 hermite
+ *   EASE_SPRING                2.3e-5       3.6e-7       1.5e-6       3.6e-7        3.6e-7       3.6e-7
+ *   EASE_OUT_EXPO              9.0e-5       1.2e-7       5.7e-6       1.2e-7        3.9e-7       1.2e-7
+ *   EASE_IN_OUT_BOUNCE         7.9e-3       3.9e-3       1.2e-3       4.2e-4        3.8e-4       1.3e-4
+ *   EASE_IN_OUT_ELASTIC        1.4e-3       2.4e-4       2.4e-4       2.4e-4        2.3e-4       2.4e-4
+ *
+ * On smooth curves linear error shrinks with the square of the resolution and Hermite error with the fourth power,
+ * until float rounding takes over. The Bounce curves have kinks where the slope flips, so both modes only improve
+ * linearly there. The Elastic curves snap to exactly start at alpha = 0, a jump of ~2.4e-4 that no table can resolve.
+ */
+
+#pragma once
+
+#include "EasingCurve.hpp"
+#include "EasingFunctions.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+enum EEaseTableInterpolation : unsigned int
+{
+    EASE_TABLE_LINEAR = 0,
+    EASE_TABLE_HERMITE
+};
+
+template<std::size_t Resolution>
+class EasingCurveTable
+{
+    static_assert(Resolution >= 2, "EasingCurveTable needs at least two intervals");
+
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    static const std::size_t CacheLineSize = 64;
+
+    constexpr EasingCurveTable()
+        : Values()
+        , Tangents()
+        , Curve()
+        , Interpolation(EASE_TABLE_LINEAR)
+    {
+        Bake(EasingFunctions::EASE_LINEAR, EASE_TABLE_LINEAR);
+    }
+
+    constexpr explicit EasingCurveTable(const EasingCurve& curve, EEaseTableInterpolation interpolation = EASE_TABLE_LINEAR)
+        : Values()
+        , Tangents()
+        , Curve(curve)
+        , Interpolation(interpolation)
+    {
+        Bake(curve, interpolation);
+    }
+
+    //
+    // Samples the curve and, for Hermite tables, its analytic slope at every table point. This is the only expensive call.
+    //
+    constexpr void Bake(const EasingCurve& curve, EEaseTableInterpolation interpolation)
+    {
+        Curve = curve;
+        Interpolation = interpolation;
+
+        for (std::size_t i = 0; i <= Resolution; ++i) {
+            Values[i] = curve.Sample(float(i) / float(Resolution));
+        }
+
+        if (interpolation == EASE_TABLE_HERMITE) {
+            for (std::size_t i = 0; i <= Resolution; ++i) {
+                // Tangents are stored per interval (slope divided by Resolution) so Sample does not rescale them.
+                Tangents[i] = float(Slope(curve, double(i) / double(Resolution)) / double(Resolution));
+            }
+        }
+    }
+
+    constexpr float Evaluate(float start, float end, float alpha) const
+    {
+        return start + (end - start) * Sample(alpha);
+    }
+
+    void EvaluateBatch(const float* start, const float* end, const float* alpha, float* out, std::size_t count) const
+    {
+        if (Interpolation == EASE_TABLE_HERMITE) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = start[i] + (end[i] - start[i]) * SampleHermite(alpha[i]);
+            }
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = start[i] + (end[i] - start[i]) * SampleLinear(alpha[i]);
+            }
+        }
+    }
+
+    //
+    // The normalized curve (start = 0, end = 1) at alpha.
+    //
+    constexpr float Sample(float alpha) const
+    {
+        return Interpolation == EASE_TABLE_HERMITE ? SampleHermite(alpha) : SampleLinear(alpha);
+    }
+
+    //
+    // Largest absolute difference between the table and GetEaseFromType over `samples` evenly spaced alphas in [0, 1].
+    // Use it to pick the smallest Resolution that meets an error budget.
+    //
+    float MeasureMaxError(std::size_t samples = 65536) const
+    {
+        float maxError = 0.0f;
+
+        for (std::size_t i = 0; i <= samples; ++i) {
+            const float alpha = float(i) / float(samples);
+            const float error = std::fabs(Sample(alpha) - Curve.Sample(alpha));
+
+            if (error > maxError) {
+                maxError = error;
+            }
+        }
+
+        return maxError;
+    }
+
+    constexpr const EasingCurve& GetCurve() const { return Curve; }
+    constexpr EEaseType GetEaseType() const { return Curve.GetEaseType(); }
+    constexpr EEaseTableInterpolation GetInterpolation() const { return Interpolation; }
+
+    //
+    // The baked points, index in [0, Resolution]. Tangents are per interval (slope / Resolution) and 0 in linear tables.
+    //
+    constexpr float GetValue(std::size_t index) const { return Values[index]; }
+    constexpr float GetTangent(std::size_t index) const { return Tangents[index]; }
+
+private:
+    constexpr float SampleLinear(float alpha) const
+    {
+        std::size_t index = 0;
+        const float t = Locate(alpha, index);
+        return Values[index] + (Values[index + 1] - Values[index]) * t;
+    }
+
+    constexpr float SampleHermite(float alpha) const
+    {
+        std::size_t index = 0;
+        const float t = Locate(alpha, index);
+
+        const float t2 = t * t;
+        const float t3 = t2 * t;
+
+        const float h00 = 2.0f * t3 - 3.0f * t2 + 1.0f;
+        const float h10 = t3 - 2.0f * t2 + t;
+        const float h01 = -2.0f * t3 + 3.0f * t2;
+        const float h11 = t3 - t2;
+
+        return h00 * Values[index] + h10 * Tangents[index] + h01 * Values[index + 1] + h11 * Tangents[index + 1];
+    }
+
+    static constexpr float Locate(float alpha, std::size_t& index)
+    {
+        const float x = (alpha < 0.0f ? 0.0f : (alpha > 1.0f ? 1.0f : alpha)) * float(Resolution);
+        const std::size_t i = std::size_t(x);
+
+        index = i < Resolution ? i : Resolution - 1;
+        return x - float(index);
+    }
+
+    static constexpr float Slope(const EasingCurve& curve, double alpha)
+    {
+        if (!curve.HasVerticalTangent()) {
+            return curve.SampleDerivative(float(alpha));
+        }
+
+        // The Circ curves (and some beziers) have vertical tangents, where the analytic slope divides by zero. Use a
+        // central difference, one sided at the ends, which gives a large but finite tangent there instead.
+        const double h = 1.0 / 4096.0;
+        const double lo = alpha - h < 0.0 ? 0.0 : alpha - h;
+        const double hi = alpha + h > 1.0 ? 1.0 : alpha + h;
+
+        const double a = curve.Sample(lo);
+        const double b = curve.Sample(hi);
+
+        return float((b - a) / (hi - lo));
+    }
+
+    alignas(CacheLineSize) float Values[Resolution + 1];
+    alignas(CacheLineSize) float Tangents[Resolution + 1];
+
+    EasingCurve Curve;
+    EEaseTableInterpolation Interpolation;
+};
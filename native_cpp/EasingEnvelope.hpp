@@ -0,0 +1,325 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * The curves as audio envelopes: attack, decay and release shapes rendered a block of samples at a time.
+ *
+ * // A 250 ms release at 48 kHz, from the current level down to silence.
+ * EasingEnvelope release(EasingFunctions::EASE_OUT_EXPO, level, 0.0f, 0.25 * 48000.0);
+ *
+ * // In the audio callback, one block after another.
+ * release.Process(gain, frameCount);
+ *
+ * // Or any stretch of it, e.g. starting 37 samples into the block because the note ended there.
+ * release.Render(-37.0, gain, frameCount);
+ *
+ * Durations and offsets are in samples (seconds times the sample rate) and need not be whole. Sample i of a render at
+ * `offset` is the curve at alpha (offset + i) / duration, computed from its own position and not carried over from
+ * the samples before it, so with whole offsets the output is bit for bit the same however the blocks are cut. Samples
+ * before the start hold the value at alpha 0 and samples past the end the value at alpha 1.
+ *
+ * The Sine, Expo and Elastic curves are stepped through EasingWave (see EasingStepper.hpp): each sample of a group
+ * of GroupSize is the complex term of the group times a fixed per sample factor, and the term is advanced once per
+ * group from an exact evaluation every SeedInterval samples. Groups and seeds sit at fixed sample indices of the
+ * envelope, not of the block. That leaves two multiplies and two adds per sample, in lanes, where GetEaseFromType
+ * would call exp2 and sin per sample; the Envelope/ entries of benchmarks/NativeCpp_bench.cpp measure it. The other
+ * curves, and envelopes shorter than MinimumSteppedDuration, go through EasingFunctionsSimd::GetEaseFromTypeBatch in
+ * blocks of BlockSize.
+ *
+ * Render and Process never allocate or lock. Reset computes the per sample factors with libm, also without
+ * allocating, and initializes the cached SIMD level so that the first render does not.
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+#include "EasingFunctionsSimd.hpp"
+#include "EasingStepper.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+class EasingEnvelope
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    static const std::size_t CacheLineSize = 64;
+    static const std::size_t GroupSize = 16;
+    static const std::size_t BlockSize = 256;
+
+    //
+    // Samples between exact evaluations of a stepped curve, a whole number of groups. A render that starts between two
+    // seeds advances from the one before it, at most SeedInterval / GroupSize - 1 complex multiplies.
+    //
+    static const std::size_t SeedInterval = 32 * GroupSize;
+
+    //
+    // Below this many samples a group could span a large part of the curve, and the factor between its first and last
+    // samples could grow past what a float holds exactly, so short envelopes are evaluated from alpha.
+    //
+    static const std::size_t MinimumSteppedDuration = 2 * GroupSize;
+
+    EasingEnvelope()
+    {
+        Reset(EasingFunctions::EASE_LINEAR, 0.0f, 0.0f, 0.0);
+    }
+
+    EasingEnvelope(EEaseType easeType, float start, float end, double duration)
+    {
+        Reset(easeType, start, end, duration);
+    }
+
+    //
+    // Sets up a new envelope and rewinds Process to its start. A duration of 0 or less holds the value at alpha 1.
+    //
+    void Reset(EEaseType easeType, float start, float end, double duration)
+    {
+        EaseType = easeType;
+        Start = start;
+        End = end;
+        Duration = duration;
+        Position = 0.0;
+        First = EasingFunctions::GetEaseFromType(easeType, start, end, 0.0f);
+        Last = EasingFunctions::GetEaseFromType(easeType, start, end, 1.0f);
+
+        const bool wave = EasingWave::FromType(easeType, false, Waves[0]);
+        EasingWave::FromType(easeType, true, Waves[1]);
+
+        Stepped = wave && Duration >= double(MinimumSteppedDuration);
+        Halves = EasingWave::HasHalves(easeType);
+
+        for (int half = 0; half < 2 && Stepped; ++half) {
+            for (std::size_t k = 0; k < GroupSize; ++k) {
+                double real = 0.0;
+                double imaginary = 0.0;
+
+                Waves[half].Rotation(double(k) / Duration, real, imaginary);
+                RotationReal[half][k] = float(real);
+                RotationImaginary[half][k] = float(imaginary);
+            }
+
+            Waves[half].Rotation(double(GroupSize) / Duration, GroupReal[half], GroupImaginary[half]);
+        }
+
+        EasingFunctionsSimd::GetSimdLevel();
+    }
+
+    //
+    // Writes `count` samples to out, starting `offset` samples into the envelope. Negative offsets start before it.
+    //
+    void Render(double offset, float* out, std::size_t count) const
+    {
+        if (!(Duration > 0.0)) {
+            Fill(out, 0, count, Last);
+            return;
+        }
+
+        // Alpha 0 itself is written as First too: the Elastic curves return their start value exactly there.
+        std::size_t begin = FirstSampleAt(offset, 0.0, count);
+        begin += begin < count && AlphaAt(offset, begin) == 0.0 ? 1 : 0;
+
+        const std::size_t finish = FirstSampleAt(offset, 1.0, count);
+
+        Fill(out, 0, begin, First);
+
+        if (Stepped) {
+            const std::size_t middle = Halves ? FirstSampleAt(offset, 0.5, count) : finish;
+
+            RenderWave(0, offset, begin, middle, out);
+            RenderWave(1, offset, middle, finish, out);
+        } else {
+            RenderBatch(offset, begin, finish, out);
+        }
+
+        Fill(out, finish, count, Last);
+    }
+
+    //
+    // Renders the next `count` samples and moves on past them.
+    //
+    void Process(float* out, std::size_t count)
+    {
+        Render(Position, out, count);
+        Position += double(count);
+    }
+
+    void Seek(double position) { Position = position; }
+
+    double GetPosition() const { return Position; }
+    double GetDuration() const { return Duration; }
+    EEaseType GetEaseType() const { return EaseType; }
+
+    //
+    // True once every sample Process writes is the value at alpha 1.
+    //
+    bool IsFinished() const { return Position >= Duration; }
+
+private:
+    double AlphaAt(double offset, std::size_t sample) const
+    {
+        return (offset + double(sample)) / Duration;
+    }
+
+    //
+    // The first of `count` samples whose alpha reaches `alpha`, with the same rounding as AlphaAt, or count.
+    //
+    std::size_t FirstSampleAt(double offset, double alpha, std::size_t count) const
+    {
+        const double estimate = std::ceil(alpha * Duration - offset);
+        std::size_t sample = estimate > 0.0 ? (estimate < double(count) ? std::size_t(estimate) : count) : 0;
+
+        while (sample > 0 && AlphaAt(offset, sample - 1) >= alpha) {
+            --sample;
+        }
+
+        while (sample < count && AlphaAt(offset, sample) < alpha) {
+            ++sample;
+        }
+
+        return sample;
+    }
+
+    static void Fill(float* out, std::size_t first, std::size_t last, float value)
+    {
+        for (std::size_t i = first; i < last; ++i) {
+            out[i] = value;
+        }
+    }
+
+    //
+    // Samples [first, last) on one half of a wave curve. Sample i is sample floor(offset) + i of the envelope, which is
+    // never negative here since its alpha is above 0; its group and seed are counted from sample 0.
+    //
+    void RenderWave(int half, double offset, std::size_t first, std::size_t last, float* out) const
+    {
+        if (first >= last) {
+            return;
+        }
+
+        const EasingWave& wave = Waves[half];
+        const double range = double(End) - double(Start);
+        const float base = float(double(Start) + range * wave.Offset);
+        const std::uint64_t sample = std::uint64_t(std::floor(offset) + double(first));
+        const std::uint64_t groupsPerSeed = SeedInterval / GroupSize;
+
+        std::uint64_t group = sample / GroupSize;
+        std::size_t k = std::size_t(sample % GroupSize);
+
+        double real = 0.0;
+        double imaginary = 0.0;
+        SeedWave(half, offset, group - group % groupsPerSeed, real, imaginary);
+
+        for (std::uint64_t skipped = 0; skipped < group % groupsPerSeed; ++skipped) {
+            AdvanceWave(half, real, imaginary);
+        }
+
+        // Local copies: out could alias the member tables as far as the compiler knows, and the loop would not
+        // vectorize.
+        float rotationReal[GroupSize];
+        float rotationImaginary[GroupSize];
+
+        for (std::size_t j = 0; j < GroupSize; ++j) {
+            rotationReal[j] = RotationReal[half][j];
+            rotationImaginary[j] = RotationImaginary[half][j];
+        }
+
+        // i is the out index of sample k of the group; only the first group of the call can start partway in.
+        for (std::size_t i = first; i < last; i += GroupSize - k, k = 0) {
+            const float groupReal = float(real);
+            const float groupImaginary = float(imaginary);
+
+            if (k == 0 && last - i >= GroupSize) {
+                for (std::size_t j = 0; j < GroupSize; ++j) {
+                    out[i + j] = base + groupReal * rotationReal[j] - groupImaginary * rotationImaginary[j];
+                }
+            } else {
+                const std::size_t end = last - i < GroupSize - k ? k + (last - i) : GroupSize;
+
+                for (std::size_t j = k; j < end; ++j) {
+                    out[i + j - k] = base + groupReal * rotationReal[j] - groupImaginary * rotationImaginary[j];
+                }
+            }
+
+            if (last - i <= GroupSize - k) {
+                break;
+            }
+
+            ++group;
+
+            if (group % groupsPerSeed == 0) {
+                SeedWave(half, offset, group, real, imaginary);
+            } else {
+                AdvanceWave(half, real, imaginary);
+            }
+        }
+    }
+
+    //
+    // The exact complex term at the first sample of `group`. A seed can lie before the start or on the other half:
+    // the wave formulas hold there too, they are just not the curve.
+    //
+    void SeedWave(int half, double offset, std::uint64_t group, double& real, double& imaginary) const
+    {
+        const double position = offset + (double(group * GroupSize) - std::floor(offset));
+        Waves[half].Evaluate(double(End) - double(Start), position / Duration, real, imaginary);
+    }
+
+    void AdvanceWave(int half, double& real, double& imaginary) const
+    {
+        const double next = real * GroupReal[half] - imaginary * GroupImaginary[half];
+        imaginary = real * GroupImaginary[half] + imaginary * GroupReal[half];
+        real = next;
+    }
+
+    //
+    // Samples [first, last) through the SIMD kernels, with the constant start and end spread over stack blocks.
+    //
+    void RenderBatch(double offset, std::size_t first, std::size_t last, float* out) const
+    {
+        float starts[BlockSize];
+        float ends[BlockSize];
+        float alphas[BlockSize];
+
+        for (std::size_t k = 0; k < BlockSize; ++k) {
+            starts[k] = Start;
+            ends[k] = End;
+        }
+
+        for (std::size_t i = first; i < last; i += BlockSize) {
+            const std::size_t count = last - i < BlockSize ? last - i : BlockSize;
+
+            // Each alpha from its own sample, so that it does not depend on where the block starts. The same as
+            // AlphaAt for whole offsets, where every position is exact; a fixed trip count of int lanes vectorizes.
+            const double position = offset + double(i);
+
+            for (int k = 0; k < int(BlockSize); ++k) {
+                alphas[k] = float((position + double(k)) / Duration);
+            }
+
+            EasingFunctionsSimd::GetEaseFromTypeBatch(EaseType, starts, ends, alphas, out + i, count);
+        }
+    }
+
+    EEaseType EaseType;
+    float Start;
+    float End;
+    float First;
+    float Last;
+    double Duration;
+    double Position;
+
+    bool Stepped;
+    bool Halves;
+    EasingWave Waves[2];
+
+    alignas(CacheLineSize) float RotationReal[2][GroupSize];
+    alignas(CacheLineSize) float RotationImaginary[2][GroupSize];
+    double GroupReal[2];
+    double GroupImaginary[2];
+};
@@ -0,0 +1,1240 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * All 32 curves and their derivatives in integer fixed point, for lockstep simulations that need bit-identical
+ * results on every client. The float curves in EasingFunctions.hpp cannot promise that: libm sin, exp2 and pow differ
+ * between platforms, and compilers contract a * b + c into an FMA on some targets and not others. Here every step is
+ * an integer add, multiply, shift or divide, and the transcendentals are lookup tables written out as integer
+ * literals, so the same inputs give the same bits on x86, ARM and any other two's complement target.
+ *
+ * EasingQ16 start = EasingQ16::FromInt(0);
+ * EasingQ16 end = EasingQ16::FromInt(10);
+ * EasingQ16 alpha = EasingQ16::FromRaw(43909); // 0.67
+ *
+ * EasingQ16 value = EasingFixedPoint::GetEaseFromType(EasingFunctions::EASE_OUT_ELASTIC, start, end, alpha);
+ * EasingQ16 speed = EasingFixedPoint::GetEaseDerivativeFromType(EasingFunctions::EASE_OUT_ELASTIC, start, end, alpha);
+ * EasingQ32 exact = EasingFixedPoint::Ease<EasingFunctions::EASE_IN_OUT_SINE>(EasingQ32::FromInt(0), EasingQ32::FromInt(1), EasingQ32::FromDouble(0.25));
+ *
+ * Two formats: EasingQ16 is Q16.16 in an int32 (range +-32768, step 1.5e-5), and EasingQ32 is Q32.32 in an int64 (range
+ * +-2^31, step 2.3e-10). Values cross into and out of fixed point through FromRaw/FromInt/FromDouble and
+ * Raw/ToDouble. The conversions from double are exact roundings, but a simulation that stays deterministic should
+ * keep its state in fixed point rather than convert every tick.
+ *
+ * The curves follow the float formulas (InExpo still starts at 2^-10, Elastic keeps its period of 0.3). Against a
+ * long double reference of those formulas (tests/NativeCpp_accuracy.cpp) the eased weight is within 9e-5 in Q16.16
+ * (1.5e-4 on Spring) and 2.5e-9 in Q32.32, and the derivatives within a relative 1e-3 and 2e-8. Two behaviours differ
+ * from the float curves:
+ *
+ *   - alpha is clamped to [0, 1], so no curve leaves its table ranges or takes the square root of a negative number
+ *   - the Circ derivatives saturate to the largest value of the format where the float ones are infinite
+ *
+ * sin and cos take their angle in turns (1 = 2 pi), so the reduction is an exact mask of the fraction bits. Sin, exp2
+ * and log2 interpolate a 257 entry Q32.32 table with a short Taylor series, which is below the Q32.32 step; the
+ * square root is an exact integer one. Q32.32 multiplies go through __int128 where the compiler has it and through
+ * 32 bit halves elsewhere, with the same rounding, so both give the same bits.
+ *
+ * Signed right shifts are assumed to be arithmetic, as they are on every compiler this library supports (and by
+ * definition from C++20).
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+//
+// Integer multiply and divide of two fixed point raw values with `bits` fraction bits. Mul rounds to nearest (half up),
+// Div truncates toward zero like integer division.
+//
+template<typename TRaw>
+struct EasingFixedArithmetic;
+
+template<>
+struct EasingFixedArithmetic<std::int32_t>
+{
+    static constexpr std::int32_t Mul(std::int32_t a, std::int32_t b, int bits)
+    {
+        return std::int32_t((std::int64_t(a) * b + (std::int64_t(1) << (bits - 1))) >> bits);
+    }
+
+    static constexpr std::int32_t Div(std::int32_t a, std::int32_t b, int bits)
+    {
+        return std::int32_t(std::int64_t(a) * (std::int64_t(1) << bits) / b);
+    }
+};
+
+template<>
+struct EasingFixedArithmetic<std::int64_t>
+{
+    static constexpr std::int64_t Mul(std::int64_t a, std::int64_t b, int bits)
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef __int128 Wide;
+        return std::int64_t((Wide(a) * b + (Wide(1) << (bits - 1))) >> bits);
+#else
+        return MulPortable(a, b, bits);
+#endif
+    }
+
+    static constexpr std::int64_t Div(std::int64_t a, std::int64_t b, int bits)
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef __int128 Wide;
+        return std::int64_t(Wide(a) * (Wide(1) << bits) / b);
+#else
+        return DivPortable(a, b, bits);
+#endif
+    }
+
+    //
+    // The 128 bit product from four 32 bit ones, corrected for the signs, rounded and shifted. Gives the same bits as
+    // the __int128 path.
+    //
+    static constexpr std::int64_t MulPortable(std::int64_t a, std::int64_t b, int bits)
+    {
+        const std::uint64_t ua = std::uint64_t(a);
+        const std::uint64_t ub = std::uint64_t(b);
+        const std::uint64_t mask = 0xFFFFFFFFu;
+
+        const std::uint64_t lowLow = (ua & mask) * (ub & mask);
+        const std::uint64_t lowHigh = (ua & mask) * (ub >> 32);
+        const std::uint64_t highLow = (ua >> 32) * (ub & mask);
+        const std::uint64_t middle = (lowLow >> 32) + (lowHigh & mask) + (highLow & mask);
+
+        std::uint64_t low = (middle << 32) | (lowLow & mask);
+        std::uint64_t high = (ua >> 32) * (ub >> 32) + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+
+        // Two's complement: an unsigned product of a negative operand is 2^64 * the other operand too large.
+        high -= a < 0 ? ub : 0;
+        high -= b < 0 ? ua : 0;
+
+        const std::uint64_t rounded = low + (std::uint64_t(1) << (bits - 1));
+        high += rounded < low ? 1 : 0;
+        low = rounded;
+
+        return std::int64_t((high << (64 - bits)) | (low >> bits));
+    }
+
+    //
+    // Long division of |a| * 2^bits by |b|, one quotient bit per step past the integer part.
+    //
+    static constexpr std::int64_t DivPortable(std::int64_t a, std::int64_t b, int bits)
+    {
+        const std::uint64_t ua = a < 0 ? 0 - std::uint64_t(a) : std::uint64_t(a);
+        const std::uint64_t ub = b < 0 ? 0 - std::uint64_t(b) : std::uint64_t(b);
+
+        std::uint64_t quotient = ua / ub;
+        std::uint64_t remainder = ua % ub;
+
+        for (int i = 0; i < bits; ++i) {
+            remainder <<= 1;
+            quotient <<= 1;
+
+            if (remainder >= ub) {
+                remainder -= ub;
+                quotient |= 1;
+            }
+        }
+
+        return (a < 0) != (b < 0) ? std::int64_t(0 - quotient) : std::int64_t(quotient);
+    }
+};
+
+//
+// A fixed point number: Raw / 2^FractionBits. A plain aggregate, so arrays of it are arrays of integers.
+//
+template<typename TRaw, int FractionBits>
+struct EasingFixed
+{
+    typedef TRaw RawType;
+
+    static constexpr int Bits = FractionBits;
+
+    TRaw Raw;
+
+    static constexpr EasingFixed FromRaw(TRaw raw)
+    {
+        return EasingFixed{ raw };
+    }
+
+    static constexpr EasingFixed FromInt(int value)
+    {
+        return EasingFixed{ TRaw(TRaw(value) * (TRaw(1) << FractionBits)) };
+    }
+
+    //
+    // Rounds to the nearest step, half away from zero. Scaling by a power of two is exact, so this is deterministic.
+    //
+    static constexpr EasingFixed FromDouble(double value)
+    {
+        const double scaled = value * double(TRaw(1) << FractionBits);
+        return EasingFixed{ TRaw(scaled < 0.0 ? scaled - 0.5 : scaled + 0.5) };
+    }
+
+    static constexpr EasingFixed Max()
+    {
+        return EasingFixed{ std::numeric_limits<TRaw>::max() };
+    }
+
+    static constexpr EasingFixed Lowest()
+    {
+        return EasingFixed{ std::numeric_limits<TRaw>::lowest() };
+    }
+
+    constexpr double ToDouble() const
+    {
+        return double(Raw) / double(TRaw(1) << FractionBits);
+    }
+
+    friend constexpr EasingFixed operator+(EasingFixed a, EasingFixed b) { return EasingFixed{ TRaw(a.Raw + b.Raw) }; }
+    friend constexpr EasingFixed operator-(EasingFixed a, EasingFixed b) { return EasingFixed{ TRaw(a.Raw - b.Raw) }; }
+    friend constexpr EasingFixed operator-(EasingFixed a) { return EasingFixed{ TRaw(-a.Raw) }; }
+
+    friend constexpr EasingFixed operator*(EasingFixed a, EasingFixed b)
+    {
+        return EasingFixed{ EasingFixedArithmetic<TRaw>::Mul(a.Raw, b.Raw, FractionBits) };
+    }
+
+    friend constexpr EasingFixed operator/(EasingFixed a, EasingFixed b)
+    {
+        return EasingFixed{ EasingFixedArithmetic<TRaw>::Div(a.Raw, b.Raw, FractionBits) };
+    }
+
+    friend constexpr bool operator==(EasingFixed a, EasingFixed b) { return a.Raw == b.Raw; }
+    friend constexpr bool operator!=(EasingFixed a, EasingFixed b) { return a.Raw != b.Raw; }
+    friend constexpr bool operator<(EasingFixed a, EasingFixed b) { return a.Raw < b.Raw; }
+    friend constexpr bool operator<=(EasingFixed a, EasingFixed b) { return a.Raw <= b.Raw; }
+    friend constexpr bool operator>(EasingFixed a, EasingFixed b) { return a.Raw > b.Raw; }
+    friend constexpr bool operator>=(EasingFixed a, EasingFixed b) { return a.Raw >= b.Raw; }
+};
+
+typedef EasingFixed<std::int32_t, 16> EasingQ16;
+typedef EasingFixed<std::int64_t, 32> EasingQ32;
+
+//
+// The lookup tables behind EasingFixedPoint, 256 intervals of Q32.32 values generated with 50 digit arithmetic. Only
+// instantiated for std::int64_t; a template so the constexpr arrays can be defined in this header, as
+// EasingFunctionTable does, since C++14 has no inline variables.
+//
+template<typename T>
+struct EasingFixedTable
+{
+    // sin(i / 256 * pi / 2), a quarter turn
+    static constexpr T Sin[257] =
+    {
+        0, 26353424, 52705856, 79056303, 105403774, 131747276, 158085819, 184418409,
+        210744057, 237061769, 263370557, 289669429, 315957395, 342233465, 368496651, 394745962,
+        420980412, 447199012, 473400776, 499584716, 525749847, 551895183, 578019742, 604122538,
+        630202589, 656258914, 682290530, 708296459, 734275721, 760227338, 786150333, 812043729,
+        837906553, 863737830, 889536587, 915301854, 941032661, 966728038, 992387019, 1018008636,
+        1043591926, 1069135926, 1094639673, 1120102207, 1145522571, 1170899806, 1196232957, 1221521071,
+        1246763195, 1271958380, 1297105676, 1322204136, 1347252816, 1372250773, 1397197066, 1422090755,
+        1446930903, 1471716574, 1496446837, 1521120759, 1545737412, 1570295869, 1594795204, 1619234497,
+        1643612827, 1667929275, 1692182927, 1716372869, 1740498191, 1764557983, 1788551342, 1812477362,
+        1836335144, 1860123788, 1883842400, 1907490086, 1931065957, 1954569124, 1977998702, 2001353810,
+        2024633568, 2047837100, 2070963532, 2094011993, 2116981616, 2139871536, 2162680890, 2185408821,
+        2208054473, 2230616993, 2253095531, 2275489241, 2297797281, 2320018810, 2342152991, 2364198992,
+        2386155981, 2408023134, 2429799626, 2451484637, 2473077351, 2494576955, 2515982640, 2537293599,
+        2558509031, 2579628136, 2600650120, 2621574191, 2642399561, 2663125446, 2683751066, 2704275644,
+        2724698408, 2745018589, 2765235421, 2785348143, 2805355999, 2825258235, 2845054101, 2864742853,
+        2884323748, 2903796051, 2923159027, 2942411948, 2961554089, 2980584729, 2999503152, 3018308645,
+        3037000500, 3055578014, 3074040487, 3092387225, 3110617535, 3128730733, 3146726136, 3164603066,
+        3182360851, 3199998822, 3217516315, 3234912670, 3252187232, 3269339351, 3286368382, 3303273682,
+        3320054617, 3336710553, 3353240863, 3369644927, 3385922125, 3402071844, 3418093478, 3433986423,
+        3449750080, 3465383855, 3480887161, 3496259414, 3511500034, 3526608449, 3541584088, 3556426389,
+        3571134792, 3585708745, 3600147697, 3614451106, 3628618433, 3642649144, 3656542712, 3670298613,
+        3683916329, 3697395348, 3710735162, 3723935269, 3736995171, 3749914379, 3762692404, 3775328765,
+        3787822988, 3800174601, 3812383140, 3824448145, 3836369162, 3848145741, 3859777440, 3871263820,
+        3882604450, 3893798902, 3904846754, 3915747591, 3926501002, 3937106583, 3947563934, 3957872662,
+        3968032378, 3978042699, 3987903250, 3997613658, 4007173558, 4016582591, 4025840401, 4034946641,
+        4043900968, 4052703044, 4061352537, 4069849124, 4078192482, 4086382299, 4094418266, 4102300081,
+        4110027446, 4117600071, 4125017671, 4132279966, 4139386683, 4146337555, 4153132319, 4159770720,
+        4166252509, 4172577440, 4178745276, 4184755784, 4190608739, 4196303920, 4201841112, 4207220108,
+        4212440704, 4217502704, 4222405917, 4227150159, 4231735252, 4236161021, 4240427302, 4244533933,
+        4248480760, 4252267634, 4255894413, 4259360959, 4262667143, 4265812840, 4268797931, 4271622305,
+        4274285855, 4276788480, 4279130086, 4281310585, 4283329896, 4285187942, 4286884652, 4288419964,
+        4289793820, 4291006167, 4292056960, 4292946160, 4293673732, 4294239650, 4294643893, 4294886444,
+        4294967296
+    };
+
+    // 2^(i / 256)
+    static constexpr T Exp2[257] =
+    {
+        4294967296, 4306612134, 4318288544, 4329996612, 4341736423, 4353508065, 4365311623, 4377147183,
+        4389014833, 4400914660, 4412846750, 4424811191, 4436808071, 4448837478, 4460899500, 4472994226,
+        4485121744, 4497282142, 4509475511, 4521701940, 4533961517, 4546254334, 4558580480, 4570940045,
+        4583333121, 4595759798, 4608220167, 4620714319, 4633242347, 4645804341, 4658400394, 4671030599,
+        4683695048, 4696393833, 4709127049, 4721894787, 4734697143, 4747534209, 4760406080, 4773312851,
+        4786254615, 4799231467, 4812243504, 4825290820, 4838373510, 4851491672, 4864645400, 4877834792,
+        4891059943, 4904320952, 4917617915, 4930950930, 4944320094, 4957725506, 4971167263, 4984645465,
+        4998160210, 5011711597, 5025299726, 5038924695, 5052586606, 5066285558, 5080021652, 5093794988,
+        5107605667, 5121453791, 5135339461, 5149262779, 5163223846, 5177222766, 5191259641, 5205334574,
+        5219447668, 5233599026, 5247788752, 5262016951, 5276283726, 5290589183, 5304933425, 5319316559,
+        5333738689, 5348199922, 5362700363, 5377240118, 5391819295, 5406438001, 5421096341, 5435794424,
+        5450532358, 5465310250, 5480128210, 5494986345, 5509884764, 5524823577, 5539802893, 5554822823,
+        5569883475, 5584984961, 5600127392, 5615310878, 5630535530, 5645801460, 5661108781, 5676457604,
+        5691848042, 5707280207, 5722754214, 5738270175, 5753828203, 5769428414, 5785070921, 5800755840,
+        5816483285, 5832253371, 5848066214, 5863921930, 5879820635, 5895762446, 5911747479, 5927775853,
+        5943847684, 5959963090, 5976122189, 5992325100, 6008571941, 6024862833, 6041197893, 6057577242,
+        6074001000, 6090469287, 6106982225, 6123539933, 6140142534, 6156790150, 6173482901, 6190220911,
+        6207004303, 6223833199, 6240707722, 6257627997, 6274594148, 6291606299, 6308664574, 6325769099,
+        6342919999, 6360117399, 6377361427, 6394652208, 6411989869, 6429374537, 6446806340, 6464285405,
+        6481811861, 6499385836, 6517007458, 6534676858, 6552394164, 6570159507, 6587973017, 6605834824,
+        6623745059, 6641703853, 6659711339, 6677767649, 6695872913, 6714027267, 6732230841, 6750483771,
+        6768786189, 6787138230, 6805540029, 6823991719, 6842493438, 6861045320, 6879647501, 6898300117,
+        6917003306, 6935757205, 6954561950, 6973417680, 6992324534, 7011282649, 7030292165, 7049353220,
+        7068465956, 7087630511, 7106847027, 7126115644, 7145436504, 7164809747, 7184235517, 7203713956,
+        7223245206, 7242829410, 7262466713, 7282157258, 7301901189, 7321698651, 7341549790, 7361454751,
+        7381413680, 7401426722, 7421494026, 7441615738, 7461792005, 7482022975, 7502308797, 7522649620,
+        7543045592, 7563496864, 7584003584, 7604565904, 7625183973, 7645857945, 7666587968, 7687374197,
+        7708216783, 7729115879, 7750071638, 7771084214, 7792153760, 7813280433, 7834464385, 7855705773,
+        7877004752, 7898361478, 7919776109, 7941248800, 7962779710, 7984368996, 8006016816, 8027723330,
+        8049488696, 8071313074, 8093196623, 8115139505, 8137141881, 8159203910, 8181325756, 8203507581,
+        8225749546, 8248051816, 8270414553, 8292837922, 8315322086, 8337867211, 8360473463, 8383141006,
+        8405870007, 8428660633, 8451513050, 8474427426, 8497403930, 8520442729, 8543543993, 8566707891,
+        8589934592
+    };
+
+    // log2(1 + i / 256)
+    static constexpr T Log2[257] =
+    {
+        0, 24157255, 48220695, 72191046, 96069025, 119855343, 143550699, 167155786,
+        190671291, 214097890, 237436253, 260687042, 283850912, 306928510, 329920477, 352827446,
+        375650043, 398388887, 421044590, 443617759, 466108993, 488518883, 510848017, 533096975,
+        555266330, 577356649, 599368495, 621302422, 643158981, 664938715, 686642163, 708269857,
+        729822324, 751300086, 772703658, 794033552, 815290272, 836474320, 857586191, 878626374,
+        899595355, 920493615, 941321628, 962079865, 982768792, 1003388871, 1023940559, 1044424306,
+        1064840562, 1085189769, 1105472367, 1125688789, 1145839467, 1165924827, 1185945290, 1205901275,
+        1225793196, 1245621463, 1265386481, 1285088654, 1304728379, 1324306051, 1343822060, 1363276795,
+        1382670639, 1402003972, 1421277169, 1440490605, 1459644648, 1478739665, 1497776018, 1516754066,
+        1535674166, 1554536671, 1573341930, 1592090289, 1610782092, 1629417679, 1647997388, 1666521551,
+        1684990500, 1703404565, 1721764068, 1740069334, 1758320682, 1776518428, 1794662886, 1812754368,
+        1830793181, 1848779632, 1866714024, 1884596657, 1902427829, 1920207835, 1937936969, 1955615520,
+        1973243777, 1990822024, 2008350545, 2025829620, 2043259528, 2060640543, 2077972941, 2095256991,
+        2112492963, 2129681124, 2146821738, 2163915068, 2180961373, 2197960912, 2214913940, 2231820712,
+        2248681479, 2265496490, 2282265995, 2298990237, 2315669461, 2332303909, 2348893820, 2365439432,
+        2381940981, 2398398701, 2414812824, 2431183582, 2447511201, 2463795910, 2480037932, 2496237492,
+        2512394810, 2528510107, 2544583599, 2560615505, 2576606038, 2592555411, 2608463835, 2624331521,
+        2640158677, 2655945509, 2671692221, 2687399018, 2703066101, 2718693670, 2734281925, 2749831063,
+        2765341278, 2780812767, 2796245722, 2811640333, 2826996792, 2842315287, 2857596005, 2872839132,
+        2888044853, 2903213350, 2918344806, 2933439400, 2948497313, 2963518722, 2978503803, 2993452732,
+        3008365682, 3023242827, 3038084339, 3052890387, 3067661140, 3082396766, 3097097433, 3111763305,
+        3126394546, 3140991321, 3155553791, 3170082117, 3184576458, 3199036973, 3213463820, 3227857155,
+        3242217134, 3256543910, 3270837638, 3285098468, 3299326552, 3313522041, 3327685082, 3341815825,
+        3355914416, 3369981001, 3384015725, 3398018732, 3411990165, 3425930167, 3439838878, 3453716438,
+        3467562987, 3481378662, 3495163602, 3508917943, 3522641820, 3536335369, 3549998721, 3563632012,
+        3577235372, 3590808933, 3604352825, 3617867177, 3631352118, 3644807776, 3658234277, 3671631748,
+        3685000315, 3698340100, 3711651229, 3724933824, 3738188006, 3751413898, 3764611620, 3777781291,
+        3790923031, 3804036958, 3817123189, 3830181840, 3843213029, 3856216870, 3869193478, 3882142967,
+        3895065449, 3907961038, 3920829844, 3933671979, 3946487554, 3959276677, 3972039458, 3984776005,
+        3997486426, 4010170828, 4022829316, 4035461997, 4048068976, 4060650357, 4073206244, 4085736740,
+        4098241947, 4110721967, 4123176902, 4135606852, 4148011918, 4160392197, 4172747791, 4185078796,
+        4197385310, 4209667431, 4221925255, 4234158878, 4246368396, 4258553902, 4270715492, 4282853259,
+        4294967296
+    };
+};
+
+template<typename T>
+constexpr T EasingFixedTable<T>::Sin[257];
+
+template<typename T>
+constexpr T EasingFixedTable<T>::Exp2[257];
+
+template<typename T>
+constexpr T EasingFixedTable<T>::Log2[257];
+
+class EasingFixedPoint
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    //
+    // The lookup tables in EasingFixedTable have TableSize intervals and hold Q32.32 values (TableBits fraction bits).
+    //
+    static const std::size_t TableSize = 256;
+    static const int TableSizeBits = 8;
+    static const int TableBits = 32;
+
+    //
+    // Out of range ease types return 0, like EasingFunctions::GetEaseFromType.
+    //
+    template<typename TFixed>
+    static constexpr TFixed GetEaseFromType(EEaseType easeType, TFixed start, TFixed end, TFixed alpha)
+    {
+        switch (easeType)
+        {
+            default:
+                return TFixed{ 0 };
+
+            case EasingFunctions::EASE_LINEAR:
+                return Ease<EasingFunctions::EASE_LINEAR>(start, end, alpha);
+
+            case EasingFunctions::EASE_SPRING:
+                return Ease<EasingFunctions::EASE_SPRING>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_QUAD:
+                return Ease<EasingFunctions::EASE_IN_QUAD>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_QUAD:
+                return Ease<EasingFunctions::EASE_OUT_QUAD>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_QUAD:
+                return Ease<EasingFunctions::EASE_IN_OUT_QUAD>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_CUBIC:
+                return Ease<EasingFunctions::EASE_IN_CUBIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_CUBIC:
+                return Ease<EasingFunctions::EASE_OUT_CUBIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_CUBIC:
+                return Ease<EasingFunctions::EASE_IN_OUT_CUBIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_QUART:
+                return Ease<EasingFunctions::EASE_IN_QUART>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_QUART:
+                return Ease<EasingFunctions::EASE_OUT_QUART>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_QUART:
+                return Ease<EasingFunctions::EASE_IN_OUT_QUART>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_QUINT:
+                return Ease<EasingFunctions::EASE_IN_QUINT>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_QUINT:
+                return Ease<EasingFunctions::EASE_OUT_QUINT>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_QUINT:
+                return Ease<EasingFunctions::EASE_IN_OUT_QUINT>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_SINE:
+                return Ease<EasingFunctions::EASE_IN_SINE>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_SINE:
+                return Ease<EasingFunctions::EASE_OUT_SINE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_SINE:
+                return Ease<EasingFunctions::EASE_IN_OUT_SINE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_EXPO:
+                return Ease<EasingFunctions::EASE_IN_EXPO>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_EXPO:
+                return Ease<EasingFunctions::EASE_OUT_EXPO>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_EXPO:
+                return Ease<EasingFunctions::EASE_IN_OUT_EXPO>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_CIRC:
+                return Ease<EasingFunctions::EASE_IN_CIRC>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_CIRC:
+                return Ease<EasingFunctions::EASE_OUT_CIRC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_CIRC:
+                return Ease<EasingFunctions::EASE_IN_OUT_CIRC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_BOUNCE:
+                return Ease<EasingFunctions::EASE_IN_BOUNCE>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_BOUNCE:
+                return Ease<EasingFunctions::EASE_OUT_BOUNCE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_BOUNCE:
+                return Ease<EasingFunctions::EASE_IN_OUT_BOUNCE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_BACK:
+                return Ease<EasingFunctions::EASE_IN_BACK>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_BACK:
+                return Ease<EasingFunctions::EASE_OUT_BACK>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_BACK:
+                return Ease<EasingFunctions::EASE_IN_OUT_BACK>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_ELASTIC:
+                return Ease<EasingFunctions::EASE_IN_ELASTIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_ELASTIC:
+                return Ease<EasingFunctions::EASE_OUT_ELASTIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_ELASTIC:
+                return Ease<EasingFunctions::EASE_IN_OUT_ELASTIC>(start, end, alpha);
+        }
+    }
+
+    //
+    // Per normalized alpha, like EasingFunctions::GetEaseDerivativeFromType. Saturates where the float derivative is
+    // infinite.
+    //
+    template<typename TFixed>
+    static constexpr TFixed GetEaseDerivativeFromType(EEaseType easeType, TFixed start, TFixed end, TFixed alpha)
+    {
+        switch (easeType)
+        {
+            default:
+                return TFixed{ 0 };
+
+            case EasingFunctions::EASE_LINEAR:
+                return EaseDerivative<EasingFunctions::EASE_LINEAR>(start, end, alpha);
+
+            case EasingFunctions::EASE_SPRING:
+                return EaseDerivative<EasingFunctions::EASE_SPRING>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_QUAD:
+                return EaseDerivative<EasingFunctions::EASE_IN_QUAD>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_QUAD:
+                return EaseDerivative<EasingFunctions::EASE_OUT_QUAD>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_QUAD:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_QUAD>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_CUBIC:
+                return EaseDerivative<EasingFunctions::EASE_IN_CUBIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_CUBIC:
+                return EaseDerivative<EasingFunctions::EASE_OUT_CUBIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_CUBIC:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_CUBIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_QUART:
+                return EaseDerivative<EasingFunctions::EASE_IN_QUART>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_QUART:
+                return EaseDerivative<EasingFunctions::EASE_OUT_QUART>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_QUART:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_QUART>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_QUINT:
+                return EaseDerivative<EasingFunctions::EASE_IN_QUINT>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_QUINT:
+                return EaseDerivative<EasingFunctions::EASE_OUT_QUINT>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_QUINT:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_QUINT>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_SINE:
+                return EaseDerivative<EasingFunctions::EASE_IN_SINE>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_SINE:
+                return EaseDerivative<EasingFunctions::EASE_OUT_SINE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_SINE:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_SINE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_EXPO:
+                return EaseDerivative<EasingFunctions::EASE_IN_EXPO>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_EXPO:
+                return EaseDerivative<EasingFunctions::EASE_OUT_EXPO>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_EXPO:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_EXPO>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_CIRC:
+                return EaseDerivative<EasingFunctions::EASE_IN_CIRC>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_CIRC:
+                return EaseDerivative<EasingFunctions::EASE_OUT_CIRC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_CIRC:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_CIRC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_BOUNCE:
+                return EaseDerivative<EasingFunctions::EASE_IN_BOUNCE>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_BOUNCE:
+                return EaseDerivative<EasingFunctions::EASE_OUT_BOUNCE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_BOUNCE:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_BOUNCE>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_BACK:
+                return EaseDerivative<EasingFunctions::EASE_IN_BACK>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_BACK:
+                return EaseDerivative<EasingFunctions::EASE_OUT_BACK>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_BACK:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_BACK>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_ELASTIC:
+                return EaseDerivative<EasingFunctions::EASE_IN_ELASTIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_OUT_ELASTIC:
+                return EaseDerivative<EasingFunctions::EASE_OUT_ELASTIC>(start, end, alpha);
+
+            case EasingFunctions::EASE_IN_OUT_ELASTIC:
+                return EaseDerivative<EasingFunctions::EASE_IN_OUT_ELASTIC>(start, end, alpha);
+        }
+    }
+
+    //
+    // The curve picked at compile time, so the switch folds away without depending on the inliner.
+    //
+    template<EEaseType EaseType, typename TFixed>
+    static constexpr TFixed Ease(TFixed start, TFixed end, TFixed alpha)
+    {
+        return start + (end - start) * Weight<EaseType>(Clamp(alpha));
+    }
+
+    template<EEaseType EaseType, typename TFixed>
+    static constexpr TFixed EaseDerivative(TFixed start, TFixed end, TFixed alpha)
+    {
+        const TFixed slope = Slope<EaseType>(Clamp(alpha));
+        const TFixed range = end - start;
+
+        if (slope == TFixed::Max()) {
+            return range.Raw > 0 ? TFixed::Max() : (range.Raw < 0 ? TFixed::Lowest() : TFixed{ 0 });
+        }
+
+        return range * slope;
+    }
+
+    //
+    // start, end, alpha and out must each point to at least `count` elements. out may alias any of the inputs. The
+    // curve is picked once per call, so each loop is a single curve the compiler can unroll and vectorize.
+    //
+    template<typename TFixed>
+    static void GetEaseFromTypeBatch(EEaseType easeType, const TFixed* start, const TFixed* end, const TFixed* alpha, TFixed* out, std::size_t count)
+    {
+        DispatchBatch(std::make_index_sequence<EasingFunctions::EASE_TYPE_COUNT>(), false, easeType, start, end, alpha, out, count);
+    }
+
+    template<typename TFixed>
+    static void GetEaseDerivativeFromTypeBatch(EEaseType easeType, const TFixed* start, const TFixed* end, const TFixed* alpha, TFixed* out, std::size_t count)
+    {
+        DispatchBatch(std::make_index_sequence<EasingFunctions::EASE_TYPE_COUNT>(), true, easeType, start, end, alpha, out, count);
+    }
+
+    //
+    // sin and cos of an angle in turns (1 = 2 pi).
+    //
+    template<typename TFixed>
+    static constexpr TFixed SinTurns(TFixed turns)
+    {
+        return SinOfFraction<TFixed>(std::uint64_t(turns.Raw));
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed CosTurns(TFixed turns)
+    {
+        return SinOfFraction<TFixed>(std::uint64_t(turns.Raw) + (std::uint64_t(1) << (TFixed::Bits - 2)));
+    }
+
+    //
+    // 2^x. Saturates to Max() when the result does not fit, and rounds to 0 below the smallest step.
+    //
+    template<typename TFixed>
+    static constexpr TFixed Exp2(TFixed x)
+    {
+        typedef typename TFixed::RawType TRaw;
+
+        const int bits = TFixed::Bits;
+        const int stepBits = bits - TableSizeBits;
+        const TRaw whole = TRaw(x.Raw >> bits);
+        const std::uint64_t fraction = std::uint64_t(x.Raw) & FractionMask(bits);
+        const std::size_t index = std::size_t(fraction >> stepBits);
+
+        // 2^(i / 256 + d) = 2^(i / 256) * e^(d ln 2), with d ln 2 < 2.8e-3.
+        const TFixed d = TFixed::FromRaw(TRaw(fraction - (std::uint64_t(index) << stepBits))) * Constant<TFixed>(NaturalLogOf2);
+        const TFixed series = One<TFixed>() + d * (One<TFixed>() + d * (Constant<TFixed>(0.5) + d * Constant<TFixed>(1.0 / 6.0)));
+        const TRaw value = (TableValue<TFixed>(EasingFixedTable<std::int64_t>::Exp2, index) * series).Raw;
+
+        const int width = int(sizeof(TRaw)) * 8;
+
+        if (whole >= 0) {
+            // value < 2^(bits + 2), and the top bit is the sign.
+            return whole <= TRaw(width - bits - 3) ? TFixed::FromRaw(TRaw(value * (TRaw(1) << whole))) : TFixed::Max();
+        }
+
+        return -whole < TRaw(width - 1) ? TFixed::FromRaw(RoundShift(value, int(-whole))) : TFixed{ 0 };
+    }
+
+    //
+    // log2(x) for x > 0; Lowest() for x <= 0.
+    //
+    template<typename TFixed>
+    static constexpr TFixed Log2(TFixed x)
+    {
+        typedef typename TFixed::RawType TRaw;
+
+        if (x.Raw <= 0) {
+            return TFixed::Lowest();
+        }
+
+        const int bits = TFixed::Bits;
+        const int stepBits = bits - TableSizeBits;
+        const std::uint64_t raw = std::uint64_t(x.Raw);
+
+        int top = 0;
+
+        for (int shift = 32; shift > 0; shift >>= 1) {
+            if ((raw >> top) >> shift) {
+                top += shift;
+            }
+        }
+
+        // x = 2^(top - bits) * mantissa, mantissa in [1, 2).
+        const std::uint64_t one = std::uint64_t(1) << bits;
+        const std::uint64_t mantissa = top > bits ? raw >> (top - bits) : raw << (bits - top);
+        const std::size_t index = std::size_t((mantissa - one) >> stepBits);
+        const std::uint64_t knot = one + (std::uint64_t(index) << stepBits);
+
+        // log2(mantissa) = log2(knot) + ln(1 + r) / ln 2 with r = (mantissa - knot) / knot < 1 / 256. The numerator is
+        // below 2^(2 * bits - 8), so the division fits in 64 bits.
+        const TFixed r = TFixed::FromRaw(TRaw(((mantissa - knot) << bits) / knot));
+        const TFixed series = r * (One<TFixed>() - r * (Constant<TFixed>(0.5) - r * Constant<TFixed>(1.0 / 3.0)));
+
+        return TFixed::FromInt(top - bits) + TableValue<TFixed>(EasingFixedTable<std::int64_t>::Log2, index)
+            + series * Constant<TFixed>(1.0 / NaturalLogOf2);
+    }
+
+    //
+    // base^exponent for base >= 0, through Exp2 and Log2. Pow(0, exponent) is 0.
+    //
+    template<typename TFixed>
+    static constexpr TFixed Pow(TFixed base, TFixed exponent)
+    {
+        return base.Raw > 0 ? Exp2(exponent * Log2(base)) : TFixed{ 0 };
+    }
+
+    //
+    // Rounded to the nearest step for every Q16.16 input and for Q32.32 inputs up to 1; above that a Q32.32 root loses
+    // a bit per factor of 4. Negative inputs give 0.
+    //
+    template<typename TFixed>
+    static constexpr TFixed Sqrt(TFixed x)
+    {
+        typedef typename TFixed::RawType TRaw;
+
+        if (x.Raw <= 0) {
+            return TFixed{ 0 };
+        }
+
+        // sqrt(raw * 2^bits), taking pairs of fraction bits off the scale until the radicand fits in 64 bits.
+        const std::uint64_t raw = std::uint64_t(x.Raw);
+        int shift = TFixed::Bits;
+        int restore = 0;
+
+        while (shift > 0 && (raw >> (64 - shift)) != 0) {
+            shift -= 2;
+            ++restore;
+        }
+
+        return TFixed::FromRaw(TRaw(IntegerSqrt(raw << shift) << restore));
+    }
+
+private:
+    static constexpr double Pi = 3.14159265358979323846;
+    static constexpr double NaturalLogOf2 = 0.69314718055994530942;
+
+    //
+    // Elastic: the float curves' period of 0.3 and phase of 0.3 / 4, with the angle in turns.
+    //
+    static constexpr double ElasticPhase = 0.075;
+    static constexpr double ElasticTurns = 1.0 / 0.3;
+    static constexpr double BackOvershoot = 1.70158;
+    static constexpr double BackInOutOvershoot = 1.70158 * 1.525;
+
+    template<typename TFixed>
+    static constexpr TFixed Constant(double value)
+    {
+        return TFixed::FromDouble(value);
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed One()
+    {
+        return TFixed::FromInt(1);
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed Clamp(TFixed alpha)
+    {
+        return alpha.Raw < 0 ? TFixed{ 0 } : (alpha > One<TFixed>() ? One<TFixed>() : alpha);
+    }
+
+    static constexpr std::uint64_t FractionMask(int bits)
+    {
+        return (std::uint64_t(1) << bits) - 1;
+    }
+
+    template<typename TRaw>
+    static constexpr TRaw RoundShift(TRaw value, int shift)
+    {
+        return shift > 0 ? TRaw((value + (TRaw(1) << (shift - 1))) >> shift) : value;
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed TableValue(const std::int64_t* table, std::size_t index)
+    {
+        return TFixed::FromRaw(typename TFixed::RawType(RoundShift(table[index], TableBits - TFixed::Bits)));
+    }
+
+    //
+    // Nearest integer to sqrt(value). The double estimate is only a starting point: the correction makes the result
+    // exact, so it does not depend on the platform's sqrt.
+    //
+    static constexpr std::uint64_t IntegerSqrt(std::uint64_t value)
+    {
+        const std::uint64_t largest = 0xFFFFFFFFu;
+        std::uint64_t root = 0;
+
+        if (EASING_IS_CONSTANT_EVALUATED()) {
+            for (std::uint64_t bit = std::uint64_t(1) << 31; bit != 0; bit >>= 1) {
+                if ((root | bit) * (root | bit) <= value) {
+                    root |= bit;
+                }
+            }
+        } else {
+            root = std::uint64_t(std::sqrt(double(value)));
+            root = root < largest ? root : largest;
+
+            while (root * root > value) {
+                --root;
+            }
+
+            while (root < largest && (root + 1) * (root + 1) <= value) {
+                ++root;
+            }
+        }
+
+        return value - root * root > root ? root + 1 : root;
+    }
+
+    //
+    // sin(2 pi * angle / 2^bits), with only the fraction bits of angle used. The top two select the quadrant and the
+    // next TableSizeBits the table entry; sin(x0 + d) = sin(x0) cos(d) + cos(x0) sin(d), with d < 6.2e-3 radians.
+    //
+    template<typename TFixed>
+    static constexpr TFixed SinOfFraction(std::uint64_t angle)
+    {
+        typedef typename TFixed::RawType TRaw;
+
+        const int bits = TFixed::Bits;
+        const int stepBits = bits - 2 - TableSizeBits;
+        const std::uint64_t quarter = std::uint64_t(1) << (bits - 2);
+        const std::uint64_t fraction = angle & FractionMask(bits);
+        const unsigned int quadrant = unsigned(fraction >> (bits - 2));
+
+        // Quadrants 1 and 3 run the quarter wave backwards.
+        std::uint64_t position = fraction & (quarter - 1);
+        position = (quadrant & 1u) ? quarter - position : position;
+
+        const std::size_t index = std::size_t(position >> stepBits);
+        const TFixed d = TFixed::FromRaw(TRaw(position - (std::uint64_t(index) << stepBits))) * Constant<TFixed>(2.0 * Pi);
+        const TFixed d2 = d * d;
+
+        const TFixed sinD = d - d * d2 * Constant<TFixed>(1.0 / 6.0);
+        const TFixed cosD = One<TFixed>() - d2 * Constant<TFixed>(0.5);
+        const TFixed value = TableValue<TFixed>(EasingFixedTable<std::int64_t>::Sin, index) * cosD
+            + TableValue<TFixed>(EasingFixedTable<std::int64_t>::Sin, TableSize - index) * sinD;
+
+        return (quadrant & 2u) ? -value : value;
+    }
+
+    /// Curves, on the normalized alpha in [0, 1] ///
+
+    template<EEaseType EaseType, typename TFixed>
+    static constexpr TFixed Weight(TFixed a)
+    {
+        const TFixed one = One<TFixed>();
+        const TFixed half = Constant<TFixed>(0.5);
+        const TFixed two = TFixed::FromInt(2);
+        const TFixed u = a - one;
+
+        switch (EaseType)
+        {
+            default:
+                return a;
+
+            case EasingFunctions::EASE_SPRING:
+                return Spring(a).Value;
+
+            case EasingFunctions::EASE_IN_QUAD:
+                return a * a;
+
+            case EasingFunctions::EASE_OUT_QUAD:
+                return a * (two - a);
+
+            case EasingFunctions::EASE_IN_OUT_QUAD:
+                return a < half ? two * a * a : one - two * u * u;
+
+            case EasingFunctions::EASE_IN_CUBIC:
+                return a * a * a;
+
+            case EasingFunctions::EASE_OUT_CUBIC:
+                return one + u * u * u;
+
+            case EasingFunctions::EASE_IN_OUT_CUBIC:
+                return a < half ? TFixed::FromInt(4) * a * a * a : one + TFixed::FromInt(4) * u * u * u;
+
+            case EasingFunctions::EASE_IN_QUART:
+                return a * a * (a * a);
+
+            case EasingFunctions::EASE_OUT_QUART:
+                return one - u * u * (u * u);
+
+            case EasingFunctions::EASE_IN_OUT_QUART:
+                return a < half ? TFixed::FromInt(8) * a * a * (a * a) : one - TFixed::FromInt(8) * u * u * (u * u);
+
+            case EasingFunctions::EASE_IN_QUINT:
+                return a * a * (a * a) * a;
+
+            case EasingFunctions::EASE_OUT_QUINT:
+                return one + u * u * (u * u) * u;
+
+            case EasingFunctions::EASE_IN_OUT_QUINT:
+                return a < half ? TFixed::FromInt(16) * a * a * (a * a) * a : one + TFixed::FromInt(16) * u * u * (u * u) * u;
+
+            case EasingFunctions::EASE_IN_SINE:
+                return one - CosTurns(a * Constant<TFixed>(0.25));
+
+            case EasingFunctions::EASE_OUT_SINE:
+                return SinTurns(a * Constant<TFixed>(0.25));
+
+            case EasingFunctions::EASE_IN_OUT_SINE:
+                return half * (one - CosTurns(a * half));
+
+            case EasingFunctions::EASE_IN_EXPO:
+                return Exp2(TFixed::FromInt(10) * u);
+
+            case EasingFunctions::EASE_OUT_EXPO:
+                return one - Exp2(TFixed::FromInt(-10) * a);
+
+            case EasingFunctions::EASE_IN_OUT_EXPO:
+                return a < half
+                    ? half * Exp2(TFixed::FromInt(20) * a - TFixed::FromInt(10))
+                    : one - half * Exp2(TFixed::FromInt(10) - TFixed::FromInt(20) * a);
+
+            case EasingFunctions::EASE_IN_CIRC:
+                return one - Sqrt(one - a * a);
+
+            case EasingFunctions::EASE_OUT_CIRC:
+                return Sqrt(one - u * u);
+
+            case EasingFunctions::EASE_IN_OUT_CIRC:
+            {
+                const TFixed v = a < half ? two * a : two * a - two;
+                const TFixed root = Sqrt(one - v * v);
+                return a < half ? half * (one - root) : half * (root + one);
+            }
+
+            case EasingFunctions::EASE_IN_BOUNCE:
+                return one - OutBounce(one - a);
+
+            case EasingFunctions::EASE_OUT_BOUNCE:
+                return OutBounce(a);
+
+            case EasingFunctions::EASE_IN_OUT_BOUNCE:
+                return a < half ? half - half * OutBounce(one - two * a) : half + half * OutBounce(two * a - one);
+
+            case EasingFunctions::EASE_IN_BACK:
+                return a * a * (Constant<TFixed>(BackOvershoot + 1.0) * a - Constant<TFixed>(BackOvershoot));
+
+            case EasingFunctions::EASE_OUT_BACK:
+                return u * u * (Constant<TFixed>(BackOvershoot + 1.0) * u + Constant<TFixed>(BackOvershoot)) + one;
+
+            case EasingFunctions::EASE_IN_OUT_BACK:
+            {
+                const TFixed s = Constant<TFixed>(BackInOutOvershoot);
+                const TFixed k = Constant<TFixed>(BackInOutOvershoot + 1.0);
+                const TFixed v = a < half ? two * a : two * a - two;
+
+                return a < half ? half * (v * v * (k * v - s)) : half * (v * v * (k * v + s) + two);
+            }
+
+            case EasingFunctions::EASE_IN_ELASTIC:
+                return a.Raw == 0 || a == one ? a : -(Exp2(TFixed::FromInt(10) * u) * ElasticWave(u));
+
+            case EasingFunctions::EASE_OUT_ELASTIC:
+                return a.Raw == 0 || a == one ? a : Exp2(TFixed::FromInt(-10) * a) * ElasticWave(a) + one;
+
+            case EasingFunctions::EASE_IN_OUT_ELASTIC:
+            {
+                const TFixed v = two * a - one;
+
+                if (a.Raw == 0 || a == one) {
+                    return a;
+                }
+
+                return a < half
+                    ? -half * (Exp2(TFixed::FromInt(10) * v) * ElasticWave(v))
+                    : half * (Exp2(TFixed::FromInt(-10) * v) * ElasticWave(v)) + one;
+            }
+        }
+    }
+
+    template<EEaseType EaseType, typename TFixed>
+    static constexpr TFixed Slope(TFixed a)
+    {
+        const TFixed one = One<TFixed>();
+        const TFixed half = Constant<TFixed>(0.5);
+        const TFixed two = TFixed::FromInt(2);
+        const TFixed u = a - one;
+        const TFixed expo = Constant<TFixed>(10.0 * NaturalLogOf2);
+
+        switch (EaseType)
+        {
+            default:
+                return one;
+
+            case EasingFunctions::EASE_SPRING:
+                return Spring(a).Velocity;
+
+            case EasingFunctions::EASE_IN_QUAD:
+                return two * a;
+
+            case EasingFunctions::EASE_OUT_QUAD:
+                return two - two * a;
+
+            case EasingFunctions::EASE_IN_OUT_QUAD:
+                return a < half ? TFixed::FromInt(4) * a : -TFixed::FromInt(4) * u;
+
+            case EasingFunctions::EASE_IN_CUBIC:
+                return TFixed::FromInt(3) * a * a;
+
+            case EasingFunctions::EASE_OUT_CUBIC:
+                return TFixed::FromInt(3) * u * u;
+
+            case EasingFunctions::EASE_IN_OUT_CUBIC:
+                return a < half ? TFixed::FromInt(12) * a * a : TFixed::FromInt(12) * u * u;
+
+            case EasingFunctions::EASE_IN_QUART:
+                return TFixed::FromInt(4) * a * a * a;
+
+            case EasingFunctions::EASE_OUT_QUART:
+                return TFixed::FromInt(-4) * u * u * u;
+
+            case EasingFunctions::EASE_IN_OUT_QUART:
+                return a < half ? TFixed::FromInt(32) * a * a * a : TFixed::FromInt(-32) * u * u * u;
+
+            case EasingFunctions::EASE_IN_QUINT:
+                return TFixed::FromInt(5) * a * a * (a * a);
+
+            case EasingFunctions::EASE_OUT_QUINT:
+                return TFixed::FromInt(5) * u * u * (u * u);
+
+            case EasingFunctions::EASE_IN_OUT_QUINT:
+                return a < half ? TFixed::FromInt(80) * a * a * (a * a) : TFixed::FromInt(80) * u * u * (u * u);
+
+            case EasingFunctions::EASE_IN_SINE:
+                return Constant<TFixed>(0.5 * Pi) * SinTurns(a * Constant<TFixed>(0.25));
+
+            case EasingFunctions::EASE_OUT_SINE:
+                return Constant<TFixed>(0.5 * Pi) * CosTurns(a * Constant<TFixed>(0.25));
+
+            case EasingFunctions::EASE_IN_OUT_SINE:
+                return Constant<TFixed>(0.5 * Pi) * SinTurns(a * half);
+
+            case EasingFunctions::EASE_IN_EXPO:
+                return expo * Exp2(TFixed::FromInt(10) * u);
+
+            case EasingFunctions::EASE_OUT_EXPO:
+                return expo * Exp2(TFixed::FromInt(-10) * a);
+
+            case EasingFunctions::EASE_IN_OUT_EXPO:
+                return expo * (a < half ? Exp2(TFixed::FromInt(20) * a - TFixed::FromInt(10)) : Exp2(TFixed::FromInt(10) - TFixed::FromInt(20) * a));
+
+            case EasingFunctions::EASE_IN_CIRC:
+                return CircSlope(a);
+
+            case EasingFunctions::EASE_OUT_CIRC:
+                return CircSlope(-u);
+
+            case EasingFunctions::EASE_IN_OUT_CIRC:
+                return CircSlope(a < half ? two * a : two - two * a);
+
+            case EasingFunctions::EASE_IN_BOUNCE:
+                return OutBounceSlope(one - a);
+
+            case EasingFunctions::EASE_OUT_BOUNCE:
+                return OutBounceSlope(a);
+
+            case EasingFunctions::EASE_IN_OUT_BOUNCE:
+                return a < half ? OutBounceSlope(one - two * a) : OutBounceSlope(two * a - one);
+
+            case EasingFunctions::EASE_IN_BACK:
+                return Constant<TFixed>(3.0 * (BackOvershoot + 1.0)) * a * a - Constant<TFixed>(2.0 * BackOvershoot) * a;
+
+            case EasingFunctions::EASE_OUT_BACK:
+                return Constant<TFixed>(3.0 * (BackOvershoot + 1.0)) * u * u + Constant<TFixed>(2.0 * BackOvershoot) * u;
+
+            case EasingFunctions::EASE_IN_OUT_BACK:
+            {
+                const TFixed v = a < half ? two * a : two * a - two;
+                const TFixed s = Constant<TFixed>(a < half ? -2.0 * BackInOutOvershoot : 2.0 * BackInOutOvershoot);
+
+                return Constant<TFixed>(3.0 * (BackInOutOvershoot + 1.0)) * v * v + s * v;
+            }
+
+            case EasingFunctions::EASE_IN_ELASTIC:
+                return OutElasticSlope(one - a);
+
+            case EasingFunctions::EASE_OUT_ELASTIC:
+                return OutElasticSlope(a);
+
+            case EasingFunctions::EASE_IN_OUT_ELASTIC:
+            {
+                // d/da of +-0.5 * 2^(+-10 v) * sin(w (v - phase)) with v = 2a - 1; the 0.5 cancels the 2 from v.
+                const TFixed v = two * a - one;
+                const TFixed w = Constant<TFixed>(2.0 * Pi * ElasticTurns);
+                const TFixed turns = (v - Constant<TFixed>(ElasticPhase)) * Constant<TFixed>(ElasticTurns);
+
+                return a < half
+                    ? -Exp2(TFixed::FromInt(10) * v) * (expo * SinTurns(turns) + w * CosTurns(turns))
+                    : Exp2(TFixed::FromInt(-10) * v) * (w * CosTurns(turns) - expo * SinTurns(turns));
+            }
+        }
+    }
+
+    template<typename TFixed>
+    struct SpringSample
+    {
+        TFixed Value;
+        TFixed Velocity;
+    };
+
+    //
+    // EaseSpring is (sin(theta) * (1 - a)^2.2 + a) * (2.2 - 1.2 a) with theta = pi a (0.2 + 2.5 a^3), here as turns.
+    // The power is split as (1 - a)^2 * (1 - a)^0.2 so only the small root goes through Exp2 and Log2.
+    //
+    template<typename TFixed>
+    static constexpr SpringSample<TFixed> Spring(TFixed a)
+    {
+        const TFixed one = One<TFixed>();
+        const TFixed q = one - a;
+        const TFixed a3 = a * a * a;
+        const TFixed turns = a * (Constant<TFixed>(0.1) + Constant<TFixed>(1.25) * a3);
+        const TFixed thetaD = Constant<TFixed>(Pi) * (Constant<TFixed>(0.2) + TFixed::FromInt(10) * a3);
+
+        const TFixed root = Pow(q, Constant<TFixed>(0.2));
+        const TFixed decay = q * root;
+        const TFixed sn = SinTurns(turns);
+        const TFixed scale = Constant<TFixed>(2.2) - Constant<TFixed>(1.2) * a;
+
+        const TFixed wave = sn * decay * q + a;
+        const TFixed waveD = CosTurns(turns) * thetaD * decay * q - Constant<TFixed>(2.2) * sn * decay + one;
+
+        return { wave * scale, waveD * scale - Constant<TFixed>(1.2) * wave };
+    }
+
+    //
+    // Which of the four parabolas alpha falls on. The joins at 1, 2 and 2.5 over 2.75 are not representable, so the
+    // test is 11 alpha < 4, 8 or 10, exact in integers where a rounded constant would put a join one step early.
+    //
+    template<typename TFixed>
+    static constexpr int BounceSegment(TFixed a)
+    {
+        typedef typename TFixed::RawType TRaw;
+
+        const TRaw scaled = a.Raw * TRaw(11);
+        const TRaw one = One<TFixed>().Raw;
+
+        return scaled < one * TRaw(4) ? 0 : (scaled < one * TRaw(8) ? 1 : (scaled < one * TRaw(10) ? 2 : 3));
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed BounceCenter(int segment)
+    {
+        return segment == 0 ? TFixed{ 0 }
+            : segment == 1 ? Constant<TFixed>(1.5 / 2.75)
+            : segment == 2 ? Constant<TFixed>(2.25 / 2.75)
+            : Constant<TFixed>(2.625 / 2.75);
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed OutBounce(TFixed a)
+    {
+        const int segment = BounceSegment(a);
+        const TFixed v = a - BounceCenter<TFixed>(segment);
+        const TFixed top = segment == 0 ? TFixed{ 0 }
+            : segment == 1 ? Constant<TFixed>(0.75)
+            : segment == 2 ? Constant<TFixed>(0.9375)
+            : Constant<TFixed>(0.984375);
+
+        return Constant<TFixed>(7.5625) * v * v + top;
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed OutBounceSlope(TFixed a)
+    {
+        return Constant<TFixed>(2.0 * 7.5625) * (a - BounceCenter<TFixed>(BounceSegment(a)));
+    }
+
+    //
+    // x / sqrt(1 - x^2), Max() where the curve is vertical.
+    //
+    template<typename TFixed>
+    static constexpr TFixed CircSlope(TFixed x)
+    {
+        const TFixed root = Sqrt(One<TFixed>() - x * x);
+        return root.Raw > 0 ? x / root : TFixed::Max();
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed ElasticWave(TFixed v)
+    {
+        return SinTurns((v - Constant<TFixed>(ElasticPhase)) * Constant<TFixed>(ElasticTurns));
+    }
+
+    template<typename TFixed>
+    static constexpr TFixed OutElasticSlope(TFixed a)
+    {
+        const TFixed turns = (a - Constant<TFixed>(ElasticPhase)) * Constant<TFixed>(ElasticTurns);
+
+        return Exp2(TFixed::FromInt(-10) * a) * (Constant<TFixed>(2.0 * Pi * ElasticTurns) * CosTurns(turns)
+            - Constant<TFixed>(10.0 * NaturalLogOf2) * SinTurns(turns));
+    }
+
+    template<EEaseType EaseType, typename TFixed>
+    static void EaseBatch(const TFixed* start, const TFixed* end, const TFixed* alpha, TFixed* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = Ease<EaseType>(start[i], end[i], alpha[i]);
+        }
+    }
+
+    template<EEaseType EaseType, typename TFixed>
+    static void EaseDerivativeBatch(const TFixed* start, const TFixed* end, const TFixed* alpha, TFixed* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = EaseDerivative<EaseType>(start[i], end[i], alpha[i]);
+        }
+    }
+
+    template<typename TFixed, std::size_t... Types>
+    static void DispatchBatch(std::index_sequence<Types...>, bool derivative, EEaseType easeType,
+        const TFixed* start, const TFixed* end, const TFixed* alpha, TFixed* out, std::size_t count)
+    {
+        typedef void (*BatchFunc)(const TFixed*, const TFixed*, const TFixed*, TFixed*, std::size_t);
+
+        static const BatchFunc eases[] = { &EaseBatch<EEaseType(Types), TFixed>... };
+        static const BatchFunc derivatives[] = { &EaseDerivativeBatch<EEaseType(Types), TFixed>... };
+
+        if (easeType >= EasingFunctions::EASE_TYPE_COUNT) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = TFixed{ 0 };
+            }
+            return;
+        }
+
+        (derivative ? derivatives : eases)[easeType](start, end, alpha, out, count);
+    }
+};
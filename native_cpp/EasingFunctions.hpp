@@ -45,24 +45,77 @@
  * Below is an example of how to use the easing functions in the file. There is a getting function that will return the function
  * from an enum. This is useful since the enum can be exposed in the editor and then the function queried during start().
  * 
- * EasingFunction.Ease ease = EasingFunction.Ease.EaseInOutQuad;
- * EasingFunction.EasingFunc func = GetEasingFunction(ease;
+ * EasingFunctions::EEaseType ease = EasingFunctions::EASE_IN_OUT_QUAD;
+ * EasingFunctions::EasingFunc<float> func = EasingFunctions::GetEasingFunction(ease);
  * 
  * float alpha = func(0, 10, 0.67f);
  * 
- * EasingFunction.EaseingFunc derivativeFunc = GetEasingFunctionDerivative(ease);
+ * EasingFunctions::EasingFunc<float> derivativeFunc = EasingFunctions::GetEasingFunctionDerivative(ease);
  * 
  * float derivativeValue = derivativeFunc(0, 10, 0.67f);
+ *
+ * When the curve is known at compile time, EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_QUAD>(0.0f, 10.0f, 0.67f)
+ * skips the lookup entirely.
+ *
+ * Requires C++14. MakeEaseTable in a constant expression requires C++17.
  */
 
+#pragma once
+
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+//
+// Every ease and derivative is constexpr. When evaluated at compile time they swap libm for the polynomial helpers at
+// the bottom of the class, so results can differ from runtime ones by up to ~2e-7 (as with EASING_FAST_MATH).
+// Compilers without std::is_constant_evaluated or its builtin can still call them at runtime, just not in constant
+// expressions of the Sine, Expo, Elastic, Circ and Spring curves.
+//
+#if defined(__cpp_lib_is_constant_evaluated)
+    #define EASING_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define EASING_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+    #define EASING_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#if !defined(EASING_IS_CONSTANT_EVALUATED)
+    #define EASING_IS_CONSTANT_EVALUATED() false
+#endif
+
+template<typename T>
+struct EasingFunctionTable;
 
 class EasingFunctions
 {
-    #define NATURAL_LOG_OF_2 0.693147181f
-    #define PI 3.14159274101257324219f
-
 public:
+    //
+    // Float constants used by the curves. Members rather than macros so they cannot collide with the includer's names.
+    // The curves themselves take PiAs<T>() and NaturalLogOf2As<T>(), which round to these for float.
+    //
+    static constexpr float Pi = 3.14159274101257324219f;
+    static constexpr float NaturalLogOf2 = 0.693147181f;
+
+    template<typename T>
+    static constexpr T PiAs()
+    {
+        return T(3.141592653589793238462643383279502884L);
+    }
+
+    template<typename T>
+    static constexpr T NaturalLogOf2As()
+    {
+        return T(0.693147180559945309417232121458176568L);
+    }
+
     enum EEaseType : unsigned int
     {
         EASE_LINEAR = 0,
@@ -99,58 +152,236 @@ public:
         EASE_IN_OUT_ELASTIC
     };
 
+    static constexpr unsigned int EASE_TYPE_COUNT = EASE_IN_OUT_ELASTIC + 1;
+
+    template<typename T>
+    using EasingFunc = T (*)(T start, T end, T alpha);
+
+    //
+    // A curve and its first two derivatives at one alpha, see GetEaseWithVelocityFromType.
+    //
+    template<typename T>
+    struct EaseSample
+    {
+        T Value;
+        T Velocity;
+        T Acceleration;
+    };
+
 private:
     template<typename T>
-    static T Lerp(T a, T b, T t)
+    static constexpr T Lerp(T a, T b, T t)
     {
         return a * (T(1.0f) -t) + (b * t);
     }
 
+    //
+    // base^exponent for base >= 0 as exp2(exponent * log2(base)), without branches or libm so it vectorizes. Relative
+    // error is below 6e-6 for base in [1e-6, 4] and |exponent| <= 8, and below 3e-6 for the (1 - alpha)^1.2 and ^2.2
+    // terms of the spring. Pow(0, exponent) is 0, which is what the curves need for exponent > 0.
+    //
     template<typename T>
-    static T Pow(T base, T exponent)
+    static constexpr T Pow(T base, T exponent)
     {
-        T result = T(1.0f);
+        const T result = FastExp2(exponent * FastLog2(base));
+        return base > T(0.0f) ? result : T(0.0f);
+    }
 
-        for (T i = 0; i < exponent; ++i) {
-            result *= base;
-        }
+    //
+    // Pow for the Spring curves: the polynomial above for float, and std::pow for double and long double, which would
+    // otherwise be held to its float accuracy. Constant evaluation and EASING_FAST_MATH always take the polynomial.
+    //
+    template<typename T>
+    static constexpr T MathPow(T base, T exponent)
+    {
+#if defined(EASING_FAST_MATH)
+        return Pow(base, exponent);
+#else
+        return std::is_same<T, float>::value || EASING_IS_CONSTANT_EVALUATED() ? Pow(base, exponent) : std::pow(base, exponent);
+#endif
+    }
 
-        return result;
+    template<typename T>
+    static constexpr T PowInt(T, std::integral_constant<int, 0>)
+    {
+        return T(1.0f);
     }
 
     template<typename T>
-    static T Sin(T x)
+    static constexpr T PowInt(T base, std::integral_constant<int, 1>)
+    {
+        return base;
+    }
+
+    template<typename T, int Exponent>
+    static constexpr T PowInt(T base, std::integral_constant<int, Exponent>)
     {
-        T result = x;
-        T term = x;
-        T x_squared = -x * x;
-        T factorial = 1;
-        T denominator = 1;
+        const T half = PowInt(base, std::integral_constant<int, Exponent / 2>());
+        return (Exponent % 2) ? half * half * base : half * half;
+    }
 
-        for (int i = 1; i < 10; i++) {
-            factorial *= i;
-            denominator *= 2 * i * (2 * i + 1);
-            term *= x_squared / denominator;
-            
-            if (i % 2 == 1) {
-                result -= term;
-            } else {
-                result += term;
+    template<typename T>
+    static constexpr T MathSin(T x)
+    {
+#if defined(EASING_FAST_MATH)
+        return FastSin(x);
+#else
+        return EASING_IS_CONSTANT_EVALUATED() ? FastSin(x) : std::sin(x);
+#endif
+    }
+
+    template<typename T>
+    static constexpr T MathCos(T x)
+    {
+#if defined(EASING_FAST_MATH)
+        return FastCos(x);
+#else
+        return EASING_IS_CONSTANT_EVALUATED() ? FastCos(x) : std::cos(x);
+#endif
+    }
+
+    template<typename T>
+    static constexpr T MathExp2(T x)
+    {
+#if defined(EASING_FAST_MATH)
+        return FastExp2(x);
+#else
+        return EASING_IS_CONSTANT_EVALUATED() ? FastExp2(x) : std::exp2(x);
+#endif
+    }
+
+    template<typename T>
+    static constexpr T MathSqrt(T x)
+    {
+        if (!EASING_IS_CONSTANT_EVALUATED()) {
+            return std::sqrt(x);
+        }
+
+        if (!(x > T(0.0f))) {
+            return x == T(0.0f) ? x : std::numeric_limits<T>::quiet_NaN();
+        }
+
+        // Newton from above, stopping as soon as the estimate no longer shrinks.
+        T root = x > T(1.0f) ? x : T(1.0f);
+
+        for (int i = 0; i < 128; ++i) {
+            const T next = T(0.5f) * (root + x / root);
+
+            if (!(next < root)) {
+                break;
             }
+
+            root = next;
+        }
+
+        return root;
+    }
+
+    template<typename T>
+    static constexpr T Round(T x)
+    {
+        if (!EASING_IS_CONSTANT_EVALUATED()) {
+            return std::nearbyint(x);
+        }
+
+        return T(static_cast<long long>(x < T(0.0f) ? x - T(0.5f) : x + T(0.5f)));
+    }
+
+    static constexpr float ScaleByPowerOfTwo(float value, int exponent)
+    {
+        if (EASING_IS_CONSTANT_EVALUATED()) {
+            return ScaleByPowerOfTwoSlow(value, exponent);
+        }
+
+        const std::uint32_t bits = std::uint32_t(exponent + 127) << 23;
+        float scale = 0.0f;
+        std::memcpy(&scale, &bits, sizeof(scale));
+        return value * scale;
+    }
+
+    template<typename T>
+    static constexpr T ScaleByPowerOfTwo(T value, int exponent)
+    {
+        return EASING_IS_CONSTANT_EVALUATED() ? ScaleByPowerOfTwoSlow(value, exponent) : std::ldexp(value, exponent);
+    }
+
+    template<typename T>
+    static constexpr T ScaleByPowerOfTwoSlow(T value, int exponent)
+    {
+        for (; exponent > 0; --exponent) value *= T(2.0f);
+        for (; exponent < 0; ++exponent) value *= T(0.5f);
+        return value;
+    }
+
+    static constexpr float SplitExponent(float value, float& exponent)
+    {
+        if (EASING_IS_CONSTANT_EVALUATED()) {
+            return SplitExponentSlow(value, exponent);
+        }
+
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+        exponent = float(int((bits >> 23) & 0xff) - 127);
+        bits = (bits & 0x007fffffu) | 0x3f800000u;
+        float mantissa = 0.0f;
+        std::memcpy(&mantissa, &bits, sizeof(mantissa));
+        return mantissa;
+    }
+
+    template<typename T>
+    static constexpr T SplitExponent(T value, T& exponent)
+    {
+        if (EASING_IS_CONSTANT_EVALUATED()) {
+            return SplitExponentSlow(value, exponent);
+        }
+
+        int e = 0;
+        const T mantissa = std::frexp(value, &e);
+        exponent = T(e - 1);
+        return mantissa * T(2.0f);
+    }
+
+    template<typename T>
+    static constexpr T SplitExponentSlow(T value, T& exponent)
+    {
+        exponent = T(0.0f);
+
+        if (!(value > T(0.0f))) {
+            return T(1.0f);
         }
 
-        return result;
+        for (; value >= T(2.0f); value *= T(0.5f)) exponent += T(1.0f);
+        for (; value < T(1.0f); value *= T(2.0f)) exponent -= T(1.0f);
+        return value;
     }
 
     template<typename T>
-    static T Clamp(T alpha, T min, T max)
+    static constexpr T Clamp(T alpha, T min, T max)
     {
         return alpha < min ? min : (alpha > max ? max : alpha);
     }
 
+    //
+    // base^Exponent by repeated squaring, unrolled at compile time. Used by the Quad, Cubic, Quart and Quint curves.
+    //
+    template<int Exponent, typename T>
+    static constexpr T Pow(T base)
+    {
+        static_assert(Exponent >= 0, "Pow<Exponent> only handles non-negative exponents");
+        return PowInt(base, std::integral_constant<int, Exponent>());
+    }
+
+    template<typename T, typename TFunc>
+    static void EaseBatch(TFunc func, const T* start, const T* end, const T* alpha, T* out, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = func(start[i], end[i], alpha[i]);
+        }
+    }
+
 public:
     template<typename T>
-    static T GetEaseFromType(EEaseType easeType, T start, T end, T alpha)
+    static constexpr T GetEaseFromType(EEaseType easeType, T start, T end, T alpha)
     {
         switch (easeType)
         {
@@ -255,674 +486,2300 @@ public:
         }
     }
 
-    /// Easing functions ///
-
+    //
+    // Evaluates `count` eases of the same type in one go. The switch is resolved once for the whole
+    // array so each curve runs as its own tight loop, which the compiler is free to vectorize.
+    //
+    // start, end, alpha and out must each point to at least `count` elements. out may alias any of the inputs.
+    //
     template<typename T>
-    static T EaseLinear(T start, T end, T alpha)
+    static void GetEaseFromTypeBatch(EEaseType easeType, const T* start, const T* end, const T* alpha, T* out, std::size_t count)
     {
-        return Lerp(start, end, alpha);
-    }
+        switch (easeType)
+        {
+            default:
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = T(0.0f);
+                }
+                return;
 
-    template<typename T>
-    static T EaseSpring(T start, T end, T alpha)
-    {
-        alpha = Clamp(alpha, T(0.0f), T(1.0f));
-        alpha = (Sin(alpha * PI * (T(0.2f) + T(2.5f) * alpha * alpha * alpha)) * Pow(T(1.0f) - alpha, T(2.2f)) + alpha) * (T(1.0f) + (T(1.2f) * (1.0f - alpha)));
+            case EEaseType::EASE_LINEAR:
+                return EaseBatch([](T s, T e, T a) { return EaseLinear(s, e, a); }, start, end, alpha, out, count);
 
-        return start + (end - start) * alpha;
-    }
+            case EEaseType::EASE_SPRING:
+                return EaseBatch([](T s, T e, T a) { return EaseSpring(s, e, a); }, start, end, alpha, out, count);
 
-    template<typename T>
-    static T EaseInQuad(T start, T end, T alpha)
-    {
-        end -= start;
-        return end * alpha * alpha + start;
-    }
+            case EEaseType::EASE_IN_QUAD:
+                return EaseBatch([](T s, T e, T a) { return EaseInQuad(s, e, a); }, start, end, alpha, out, count);
 
-    template<typename T>
-    static T EaseOutQuad(T start, T end, T alpha)
-    {
-        end -= start;
-        return -end * alpha * (alpha - T(2.0f)) + start;
-    }
+            case EEaseType::EASE_OUT_QUAD:
+                return EaseBatch([](T s, T e, T a) { return EaseOutQuad(s, e, a); }, start, end, alpha, out, count);
 
-    template<typename T>
-    static T EaseInOutQuad(T start, T end, T alpha)
-    {
-        alpha /= T(0.5f);
-        end -= start;
-        if (alpha < T(1.0f)) return end * T(0.5f) * alpha * alpha + start;
-        alpha--;
-        return -end * T(0.5f) * (alpha * (alpha - T(2.0f)) - T(1.0f)) + start;
-    }
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutQuad(s, e, a); }, start, end, alpha, out, count);
 
-    template<typename T>
-    static float EaseInCubic(T start, T end, T alpha)
-    {
-        end -= start;
-        return end * alpha * alpha * alpha + start;
-    }
+            case EEaseType::EASE_IN_CUBIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInCubic(s, e, a); }, start, end, alpha, out, count);
 
-    template<typename T>
-    static float EaseOutCubic(T start, T end, T alpha)
-    {
-        alpha--;
-        end -= start;
-        return end * (alpha * alpha * alpha + T(1.0f)) + start;
-    }
+            case EEaseType::EASE_OUT_CUBIC:
+                return EaseBatch([](T s, T e, T a) { return EaseOutCubic(s, e, a); }, start, end, alpha, out, count);
 
-    template<typename T>
-    static float EaseInOutCubic(T start, T end, T alpha)
-    {
-        alpha /= T(0.5f);
-        end -= start;
-        if (alpha < T(1.0f)) return end * T(0.5f) * alpha * alpha * alpha + start;
-        alpha -= T(2.0f);
-        return end * T(0.5f) * (alpha * alpha * alpha + T(2.0f)) + start;
-    }
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutCubic(s, e, a); }, start, end, alpha, out, count);
 
-    template<typename T>
-    static float EaseInQuart(T start, T end, T alpha)
-    {
-        end -= start;
-        return end * alpha * alpha * alpha * alpha + start;
+            case EEaseType::EASE_IN_QUART:
+                return EaseBatch([](T s, T e, T a) { return EaseInQuart(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUART:
+                return EaseBatch([](T s, T e, T a) { return EaseOutQuart(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutQuart(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_QUINT:
+                return EaseBatch([](T s, T e, T a) { return EaseInQuint(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUINT:
+                return EaseBatch([](T s, T e, T a) { return EaseOutQuint(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutQuint(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_SINE:
+                return EaseBatch([](T s, T e, T a) { return EaseInSine(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_SINE:
+                return EaseBatch([](T s, T e, T a) { return EaseOutSine(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutSine(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_EXPO:
+                return EaseBatch([](T s, T e, T a) { return EaseInExpo(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_EXPO:
+                return EaseBatch([](T s, T e, T a) { return EaseOutExpo(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutExpo(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_CIRC:
+                return EaseBatch([](T s, T e, T a) { return EaseInCirc(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_CIRC:
+                return EaseBatch([](T s, T e, T a) { return EaseOutCirc(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutCirc(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_BOUNCE:
+                return EaseBatch([](T s, T e, T a) { return EaseInBounce(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                return EaseBatch([](T s, T e, T a) { return EaseOutBounce(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutBounce(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_BACK:
+                return EaseBatch([](T s, T e, T a) { return EaseInBack(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_BACK:
+                return EaseBatch([](T s, T e, T a) { return EaseOutBack(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutBack(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_ELASTIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInElastic(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                return EaseBatch([](T s, T e, T a) { return EaseOutElastic(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutElastic(s, e, a); }, start, end, alpha, out, count);
+        }
     }
 
+    //
+    // The slope of the curve with respect to the normalized alpha, i.e. the velocity in units per full ease. Divide by
+    // the ease duration in seconds to get units per second.
+    //
     template<typename T>
-    static float EaseOutQuart(T start, T end, T alpha)
+    static constexpr T GetEaseDerivativeFromType(EEaseType easeType, T start, T end, T alpha)
     {
-        alpha--;
-        end -= start;
-        return -end * (alpha * alpha * alpha * alpha - T(1.0f)) + start;
-    }
+        switch (easeType)
+        {
+            default:
+                return T(0.0f);
 
-    static float EaseInOutQuart(float start, float end, float alpha)
-    {
-        alpha /= 0.5f;
-        end -= start;
-        if (alpha < 1) return end * 0.5f * alpha * alpha * alpha * alpha + start;
-        alpha -= 2;
-        return -end * 0.5f * (alpha * alpha * alpha * alpha - 2) + start;
-    }
+            case EEaseType::EASE_LINEAR:
+                return LinearD(start, end, alpha);
 
-    static float EaseInQuint(float start, float end, float alpha)
-    {
-        end -= start;
-        return end * alpha * alpha * alpha * alpha * alpha + start;
-    }
+            case EEaseType::EASE_SPRING:
+                return SpringD(start, end, alpha);
 
-    static float EaseOutQuint(float start, float end, float alpha)
-    {
-        alpha--;
-        end -= start;
-        return end * (alpha * alpha * alpha * alpha * alpha + 1) + start;
-    }
+            case EEaseType::EASE_IN_QUAD:
+                return EaseInQuadD(start, end, alpha);
 
-    static float EaseInOutQuint(float start, float end, float alpha)
-    {
-        alpha /= 0.5f;
-        end -= start;
-        if (alpha < 1) return end * 0.5f * alpha * alpha * alpha * alpha * alpha + start;
-        alpha -= 2;
-        return end * 0.5f * (alpha * alpha * alpha * alpha * alpha + 2) + start;
-    }
+            case EEaseType::EASE_OUT_QUAD:
+                return EaseOutQuadD(start, end, alpha);
 
-    static float EaseInSine(float start, float end, float alpha)
-    {
-        end -= start;
-        return -end * std::cos(alpha * (PI * 0.5f)) + end + start;
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return EaseInOutQuadD(start, end, alpha);
+
+            case EEaseType::EASE_IN_CUBIC:
+                return EaseInCubicD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_CUBIC:
+                return EaseOutCubicD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return EaseInOutCubicD(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUART:
+                return EaseInQuartD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUART:
+                return EaseOutQuartD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                return EaseInOutQuartD(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUINT:
+                return EaseInQuintD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUINT:
+                return EaseOutQuintD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return EaseInOutQuintD(start, end, alpha);
+
+            case EEaseType::EASE_IN_SINE:
+                return EaseInSineD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_SINE:
+                return EaseOutSineD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                return EaseInOutSineD(start, end, alpha);
+
+            case EEaseType::EASE_IN_EXPO:
+                return EaseInExpoD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_EXPO:
+                return EaseOutExpoD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                return EaseInOutExpoD(start, end, alpha);
+
+            case EEaseType::EASE_IN_CIRC:
+                return EaseInCircD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_CIRC:
+                return EaseOutCircD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                return EaseInOutCircD(start, end, alpha);
+
+            case EEaseType::EASE_IN_BOUNCE:
+                return EaseInBounceD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                return EaseOutBounceD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                return EaseInOutBounceD(start, end, alpha);
+
+            case EEaseType::EASE_IN_BACK:
+                return EaseInBackD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_BACK:
+                return EaseOutBackD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                return EaseInOutBackD(start, end, alpha);
+
+            case EEaseType::EASE_IN_ELASTIC:
+                return EaseInElasticD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                return EaseOutElasticD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                return EaseInOutElasticD(start, end, alpha);
+        }
+    }
+
+    //
+    // Batch version of GetEaseDerivativeFromType, with the same contract as GetEaseFromTypeBatch.
+    //
+    template<typename T>
+    static void GetEaseDerivativeFromTypeBatch(EEaseType easeType, const T* start, const T* end, const T* alpha, T* out, std::size_t count)
+    {
+        switch (easeType)
+        {
+            default:
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = T(0.0f);
+                }
+                return;
+
+            case EEaseType::EASE_LINEAR:
+                return EaseBatch([](T s, T e, T a) { return LinearD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_SPRING:
+                return EaseBatch([](T s, T e, T a) { return SpringD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_QUAD:
+                return EaseBatch([](T s, T e, T a) { return EaseInQuadD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUAD:
+                return EaseBatch([](T s, T e, T a) { return EaseOutQuadD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutQuadD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_CUBIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInCubicD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_CUBIC:
+                return EaseBatch([](T s, T e, T a) { return EaseOutCubicD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutCubicD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_QUART:
+                return EaseBatch([](T s, T e, T a) { return EaseInQuartD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUART:
+                return EaseBatch([](T s, T e, T a) { return EaseOutQuartD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutQuartD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_QUINT:
+                return EaseBatch([](T s, T e, T a) { return EaseInQuintD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUINT:
+                return EaseBatch([](T s, T e, T a) { return EaseOutQuintD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutQuintD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_SINE:
+                return EaseBatch([](T s, T e, T a) { return EaseInSineD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_SINE:
+                return EaseBatch([](T s, T e, T a) { return EaseOutSineD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutSineD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_EXPO:
+                return EaseBatch([](T s, T e, T a) { return EaseInExpoD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_EXPO:
+                return EaseBatch([](T s, T e, T a) { return EaseOutExpoD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutExpoD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_CIRC:
+                return EaseBatch([](T s, T e, T a) { return EaseInCircD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_CIRC:
+                return EaseBatch([](T s, T e, T a) { return EaseOutCircD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutCircD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_BOUNCE:
+                return EaseBatch([](T s, T e, T a) { return EaseInBounceD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                return EaseBatch([](T s, T e, T a) { return EaseOutBounceD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutBounceD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_BACK:
+                return EaseBatch([](T s, T e, T a) { return EaseInBackD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_BACK:
+                return EaseBatch([](T s, T e, T a) { return EaseOutBackD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutBackD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_ELASTIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInElasticD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                return EaseBatch([](T s, T e, T a) { return EaseOutElasticD(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                return EaseBatch([](T s, T e, T a) { return EaseInOutElasticD(s, e, a); }, start, end, alpha, out, count);
+        }
+    }
+
+    //
+    // Value, velocity and acceleration of a curve in one call. Velocity and Acceleration are per normalized alpha, like
+    // the *D functions; divide by the duration (squared for Acceleration) to get per second values.
+    //
+    // Controllers that need both the position and the speed should call this instead of GetEaseFromType followed by
+    // GetEaseDerivativeFromType: the exp2, sin and cos terms are evaluated once and shared by all three results, and the
+    // compiler drops the Acceleration math when it is not read. Every curve is computed on its unit shape and scaled by
+    // (end - start) once at the end. Values agree with GetEaseFromType to float rounding, including the exact end points
+    // of the Elastic curves.
+    //
+    template<typename T>
+    static constexpr EaseSample<T> GetEaseWithVelocityFromType(EEaseType easeType, T start, T end, T alpha)
+    {
+        EaseSample<T> sample = MakeSample(T(0.0f), T(0.0f), T(0.0f));
+
+        switch (easeType)
+        {
+            default:
+                return sample;
+
+            case EEaseType::EASE_LINEAR:
+                sample = MakeSample(alpha, T(1.0f), T(0.0f));
+                break;
+
+            case EEaseType::EASE_SPRING:
+                sample = SampleSpring(alpha);
+                break;
+
+            case EEaseType::EASE_IN_QUAD:
+                sample = SampleInPolynomial<2>(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_QUAD:
+                sample = MirrorSample(SampleInPolynomial<2>(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_QUAD:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInPolynomial<2>(T(2.0f) * alpha)
+                    : MirrorSample(SampleInPolynomial<2>(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_CUBIC:
+                sample = SampleInPolynomial<3>(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_CUBIC:
+                sample = MirrorSample(SampleInPolynomial<3>(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInPolynomial<3>(T(2.0f) * alpha)
+                    : MirrorSample(SampleInPolynomial<3>(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_QUART:
+                sample = SampleInPolynomial<4>(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_QUART:
+                sample = MirrorSample(SampleInPolynomial<4>(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInPolynomial<4>(T(2.0f) * alpha)
+                    : MirrorSample(SampleInPolynomial<4>(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_QUINT:
+                sample = SampleInPolynomial<5>(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_QUINT:
+                sample = MirrorSample(SampleInPolynomial<5>(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInPolynomial<5>(T(2.0f) * alpha)
+                    : MirrorSample(SampleInPolynomial<5>(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_SINE:
+                sample = SampleInSine(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_SINE:
+                sample = MirrorSample(SampleInSine(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInSine(T(2.0f) * alpha)
+                    : MirrorSample(SampleInSine(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_EXPO:
+                sample = SampleInExpo(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_EXPO:
+                sample = MirrorSample(SampleInExpo(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInExpo(T(2.0f) * alpha)
+                    : MirrorSample(SampleInExpo(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_CIRC:
+                sample = SampleInCirc(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_CIRC:
+                sample = MirrorSample(SampleInCirc(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInCirc(T(2.0f) * alpha)
+                    : MirrorSample(SampleInCirc(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_BOUNCE:
+                sample = MirrorSample(SampleOutBounce(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                sample = SampleOutBounce(alpha);
+                break;
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? MirrorSample(SampleOutBounce(T(1.0f) - T(2.0f) * alpha))
+                    : SampleOutBounce(T(2.0f) * alpha - T(1.0f)), alpha);
+                break;
+
+            case EEaseType::EASE_IN_BACK:
+                sample = SampleInBack(alpha, T(1.70158L));
+                break;
+
+            case EEaseType::EASE_OUT_BACK:
+                sample = MirrorSample(SampleInBack(T(1.0f) - alpha, T(1.70158L)));
+                break;
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInBack(T(2.0f) * alpha, T(1.70158L) * T(1.525L))
+                    : MirrorSample(SampleInBack(T(2.0f) - T(2.0f) * alpha, T(1.70158L) * T(1.525L))), alpha);
+                break;
+
+            case EEaseType::EASE_IN_ELASTIC:
+                sample = SampleInElastic(alpha);
+                break;
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                sample = MirrorSample(SampleInElastic(T(1.0f) - alpha));
+                break;
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                sample = HalfSample(alpha < T(0.5f)
+                    ? SampleInElastic(T(2.0f) * alpha)
+                    : MirrorSample(SampleInElastic(T(2.0f) - T(2.0f) * alpha)), alpha);
+                break;
+        }
+
+        end -= start;
+        return MakeSample(start + end * sample.Value, end * sample.Velocity, end * sample.Acceleration);
+    }
+
+    //
+    // The inverse of a curve: the first alpha in [0, 1] at which GetEaseFromType(easeType, start, end, alpha) reaches
+    // value. For scrubbing and time remapping, where the question is when a tween gets somewhere rather than where it is.
+    //
+    // Quad, Cubic, Quart, Quint, Sine, Expo, Circ and Bounce are solved in closed form. Spring, Back and Elastic are not
+    // monotonic: the first crossing is bracketed from a 64 step table of the curve and its turning points, built once per
+    // curve on first use, and then refined with Halley's method on GetEaseWithVelocityFromType, typically in two
+    // evaluations. A value the curve never reaches gives the alpha where it comes closest: 0 or 1 for the monotonic
+    // curves, the lowest or highest point for the others. Returns 0 when start == end.
+    //
+    template<typename T>
+    static T GetEaseInverseFromType(EEaseType easeType, T start, T end, T value)
+    {
+        if (end == start) {
+            return T(0.0f);
+        }
+
+        const T u = (value - start) / (end - start);
+
+        switch (easeType)
+        {
+            default:
+                return T(0.0f);
+
+            case EEaseType::EASE_LINEAR:
+                return Clamp(u, T(0.0f), T(1.0f));
+
+            case EEaseType::EASE_SPRING:
+                return InverseBySearch<EEaseType::EASE_SPRING>(u);
+
+            case EEaseType::EASE_IN_QUAD:
+                return InverseInPolynomial<2>(u);
+
+            case EEaseType::EASE_OUT_QUAD:
+                return InverseOut(&InverseInPolynomial<2, T>, u);
+
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return InverseInOut(&InverseInPolynomial<2, T>, u);
+
+            case EEaseType::EASE_IN_CUBIC:
+                return InverseInPolynomial<3>(u);
+
+            case EEaseType::EASE_OUT_CUBIC:
+                return InverseOut(&InverseInPolynomial<3, T>, u);
+
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return InverseInOut(&InverseInPolynomial<3, T>, u);
+
+            case EEaseType::EASE_IN_QUART:
+                return InverseInPolynomial<4>(u);
+
+            case EEaseType::EASE_OUT_QUART:
+                return InverseOut(&InverseInPolynomial<4, T>, u);
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                return InverseInOut(&InverseInPolynomial<4, T>, u);
+
+            case EEaseType::EASE_IN_QUINT:
+                return InverseInPolynomial<5>(u);
+
+            case EEaseType::EASE_OUT_QUINT:
+                return InverseOut(&InverseInPolynomial<5, T>, u);
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return InverseInOut(&InverseInPolynomial<5, T>, u);
+
+            case EEaseType::EASE_IN_SINE:
+                return InverseInSine(u);
+
+            case EEaseType::EASE_OUT_SINE:
+                return InverseOut(&InverseInSine<T>, u);
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                return InverseInOut(&InverseInSine<T>, u);
+
+            case EEaseType::EASE_IN_EXPO:
+                return InverseInExpo(u);
+
+            case EEaseType::EASE_OUT_EXPO:
+                return InverseOut(&InverseInExpo<T>, u);
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                return InverseInOut(&InverseInExpo<T>, u);
+
+            case EEaseType::EASE_IN_CIRC:
+                return InverseInCirc(u);
+
+            case EEaseType::EASE_OUT_CIRC:
+                return InverseOut(&InverseInCirc<T>, u);
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                return InverseInOut(&InverseInCirc<T>, u);
+
+            case EEaseType::EASE_IN_BOUNCE:
+                return InverseInBounce(u);
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                return InverseOutBounce(u);
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                // The first half never rises above 1/2, so anything higher is first reached in the second half.
+                return u < T(0.5f) ? T(0.5f) * InverseInBounce(T(2.0f) * u) : T(0.5f) + T(0.5f) * InverseOutBounce(T(2.0f) * u - T(1.0f));
+
+            case EEaseType::EASE_IN_BACK:
+                return InverseBySearch<EEaseType::EASE_IN_BACK>(u);
+
+            case EEaseType::EASE_OUT_BACK:
+                return InverseBySearch<EEaseType::EASE_OUT_BACK>(u);
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                return InverseBySearch<EEaseType::EASE_IN_OUT_BACK>(u);
+
+            case EEaseType::EASE_IN_ELASTIC:
+                return InverseBySearch<EEaseType::EASE_IN_ELASTIC>(u);
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                return InverseBySearch<EEaseType::EASE_OUT_ELASTIC>(u);
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                return InverseBySearch<EEaseType::EASE_IN_OUT_ELASTIC>(u);
+        }
+    }
+
+    //
+    // The average velocity over [from, to]: the displacement divided by the alpha interval, per normalized alpha like the
+    // *D functions. Integrating a *D derivative over an interval gives back the ease, so the displacement is exact with
+    // two evaluations and no numerical integration. An empty interval gives the velocity at that alpha. For the distance
+    // travelled including overshoots, and for integrals of the eased value itself, see EasingIntegralTable.hpp.
+    //
+    template<typename T>
+    static constexpr T GetEaseAverageVelocityFromType(EEaseType easeType, T start, T end, T from, T to)
+    {
+        return from == to
+            ? GetEaseDerivativeFromType(easeType, start, end, from)
+            : (GetEaseFromType(easeType, start, end, to) - GetEaseFromType(easeType, start, end, from)) / (to - from);
+    }
+
+    //
+    // The ease for a curve known at compile time. The switch is on a template argument, so it folds away and the curve
+    // inlines into the caller as if it had been called directly.
+    //
+    template<EEaseType EaseType, typename T>
+    static constexpr T Ease(T start, T end, T alpha)
+    {
+        switch (EaseType)
+        {
+            default:
+                return T(0.0f);
+
+            case EEaseType::EASE_LINEAR:
+                return EaseLinear(start, end, alpha);
+
+            case EEaseType::EASE_SPRING:
+                return EaseSpring(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUAD:
+                return EaseInQuad(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUAD:
+                return EaseOutQuad(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return EaseInOutQuad(start, end, alpha);
+
+            case EEaseType::EASE_IN_CUBIC:
+                return EaseInCubic(start, end, alpha);
+
+            case EEaseType::EASE_OUT_CUBIC:
+                return EaseOutCubic(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return EaseInOutCubic(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUART:
+                return EaseInQuart(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUART:
+                return EaseOutQuart(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                return EaseInOutQuart(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUINT:
+                return EaseInQuint(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUINT:
+                return EaseOutQuint(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return EaseInOutQuint(start, end, alpha);
+
+            case EEaseType::EASE_IN_SINE:
+                return EaseInSine(start, end, alpha);
+
+            case EEaseType::EASE_OUT_SINE:
+                return EaseOutSine(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                return EaseInOutSine(start, end, alpha);
+
+            case EEaseType::EASE_IN_EXPO:
+                return EaseInExpo(start, end, alpha);
+
+            case EEaseType::EASE_OUT_EXPO:
+                return EaseOutExpo(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                return EaseInOutExpo(start, end, alpha);
+
+            case EEaseType::EASE_IN_CIRC:
+                return EaseInCirc(start, end, alpha);
+
+            case EEaseType::EASE_OUT_CIRC:
+                return EaseOutCirc(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                return EaseInOutCirc(start, end, alpha);
+
+            case EEaseType::EASE_IN_BOUNCE:
+                return EaseInBounce(start, end, alpha);
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                return EaseOutBounce(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                return EaseInOutBounce(start, end, alpha);
+
+            case EEaseType::EASE_IN_BACK:
+                return EaseInBack(start, end, alpha);
+
+            case EEaseType::EASE_OUT_BACK:
+                return EaseOutBack(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                return EaseInOutBack(start, end, alpha);
+
+            case EEaseType::EASE_IN_ELASTIC:
+                return EaseInElastic(start, end, alpha);
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                return EaseOutElastic(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                return EaseInOutElastic(start, end, alpha);
+        }
+    }
+
+    template<EEaseType EaseType, typename T>
+    static constexpr T EaseDerivative(T start, T end, T alpha)
+    {
+        switch (EaseType)
+        {
+            default:
+                return T(0.0f);
+
+            case EEaseType::EASE_LINEAR:
+                return LinearD(start, end, alpha);
+
+            case EEaseType::EASE_SPRING:
+                return SpringD(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUAD:
+                return EaseInQuadD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUAD:
+                return EaseOutQuadD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return EaseInOutQuadD(start, end, alpha);
+
+            case EEaseType::EASE_IN_CUBIC:
+                return EaseInCubicD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_CUBIC:
+                return EaseOutCubicD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return EaseInOutCubicD(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUART:
+                return EaseInQuartD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUART:
+                return EaseOutQuartD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                return EaseInOutQuartD(start, end, alpha);
+
+            case EEaseType::EASE_IN_QUINT:
+                return EaseInQuintD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_QUINT:
+                return EaseOutQuintD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return EaseInOutQuintD(start, end, alpha);
+
+            case EEaseType::EASE_IN_SINE:
+                return EaseInSineD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_SINE:
+                return EaseOutSineD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                return EaseInOutSineD(start, end, alpha);
+
+            case EEaseType::EASE_IN_EXPO:
+                return EaseInExpoD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_EXPO:
+                return EaseOutExpoD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                return EaseInOutExpoD(start, end, alpha);
+
+            case EEaseType::EASE_IN_CIRC:
+                return EaseInCircD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_CIRC:
+                return EaseOutCircD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                return EaseInOutCircD(start, end, alpha);
+
+            case EEaseType::EASE_IN_BOUNCE:
+                return EaseInBounceD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                return EaseOutBounceD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                return EaseInOutBounceD(start, end, alpha);
+
+            case EEaseType::EASE_IN_BACK:
+                return EaseInBackD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_BACK:
+                return EaseOutBackD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                return EaseInOutBackD(start, end, alpha);
+
+            case EEaseType::EASE_IN_ELASTIC:
+                return EaseInElasticD(start, end, alpha);
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                return EaseOutElasticD(start, end, alpha);
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                return EaseInOutElasticD(start, end, alpha);
+        }
+    }
+
+    template<EEaseType EaseType, typename T>
+    static T EaseInverse(T start, T end, T value)
+    {
+        return GetEaseInverseFromType(EaseType, start, end, value);
+    }
+
+    //
+    // Resolve the curve once, e.g. when a tween starts, and call through the pointer afterwards. Both read from constexpr
+    // tables indexed by the ease type and return nullptr for values outside the enum.
+    //
+    template<typename T = float>
+    static constexpr EasingFunc<T> GetEasingFunction(EEaseType easeType)
+    {
+        return easeType < EASE_TYPE_COUNT ? EasingFunctionTable<T>::Eases[easeType] : nullptr;
+    }
+
+    template<typename T = float>
+    static constexpr EasingFunc<T> GetEasingFunctionDerivative(EEaseType easeType)
+    {
+        return easeType < EASE_TYPE_COUNT ? EasingFunctionTable<T>::Derivatives[easeType] : nullptr;
+    }
+
+    //
+    // Samples the normalized curve (start = 0, end = 1) at Size evenly spaced alphas from 0 to 1 inclusive. Usable in a
+    // constant expression (C++17), which puts the whole table in read-only data:
+    //
+    // static constexpr auto table = EasingFunctions::MakeEaseTable<256>(EasingFunctions::EASE_OUT_BOUNCE);
+    //
+    template<std::size_t Size, typename T = float>
+    static constexpr std::array<T, Size> MakeEaseTable(EEaseType easeType)
+    {
+        static_assert(Size >= 2, "MakeEaseTable needs at least two samples");
+
+        std::array<T, Size> table = {};
+
+        for (std::size_t i = 0; i < Size; ++i) {
+            table[i] = GetEaseFromType(easeType, T(0.0f), T(1.0f), T(i) / T(Size - 1));
+        }
+
+        return table;
+    }
+
+    /// Easing functions ///
+
+    template<typename T>
+    static constexpr T EaseLinear(T start, T end, T alpha)
+    {
+        return Lerp(start, end, alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseSpring(T start, T end, T alpha)
+    {
+        alpha = Clamp(alpha, T(0.0f), T(1.0f));
+        alpha = (MathSin(alpha * PiAs<T>() * (T(0.2L) + T(2.5f) * alpha * alpha * alpha)) * MathPow(T(1.0f) - alpha, T(2.2L)) + alpha) * (T(1.0f) + (T(1.2L) * (T(1.0f) - alpha)));
+
+        return start + (end - start) * alpha;
+    }
+
+    template<typename T>
+    static constexpr T EaseInQuad(T start, T end, T alpha)
+    {
+        end -= start;
+        return end * Pow<2>(alpha) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutQuad(T start, T end, T alpha)
+    {
+        end -= start;
+        return -end * alpha * (alpha - T(2.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutQuad(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+        if (alpha < T(1.0f)) return end * T(0.5f) * Pow<2>(alpha) + start;
+        alpha--;
+        return -end * T(0.5f) * (alpha * (alpha - T(2.0f)) - T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInCubic(T start, T end, T alpha)
+    {
+        end -= start;
+        return end * Pow<3>(alpha) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutCubic(T start, T end, T alpha)
+    {
+        alpha--;
+        end -= start;
+        return end * (Pow<3>(alpha) + T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutCubic(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+        if (alpha < T(1.0f)) return end * T(0.5f) * Pow<3>(alpha) + start;
+        alpha -= T(2.0f);
+        return end * T(0.5f) * (Pow<3>(alpha) + T(2.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInQuart(T start, T end, T alpha)
+    {
+        end -= start;
+        return end * Pow<4>(alpha) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutQuart(T start, T end, T alpha)
+    {
+        alpha--;
+        end -= start;
+        return -end * (Pow<4>(alpha) - T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutQuart(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+        if (alpha < T(1.0f)) return end * T(0.5f) * Pow<4>(alpha) + start;
+        alpha -= T(2.0f);
+        return -end * T(0.5f) * (Pow<4>(alpha) - T(2.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInQuint(T start, T end, T alpha)
+    {
+        end -= start;
+        return end * Pow<5>(alpha) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutQuint(T start, T end, T alpha)
+    {
+        alpha--;
+        end -= start;
+        return end * (Pow<5>(alpha) + T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutQuint(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+        if (alpha < T(1.0f)) return end * T(0.5f) * Pow<5>(alpha) + start;
+        alpha -= T(2.0f);
+        return end * T(0.5f) * (Pow<5>(alpha) + T(2.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInSine(T start, T end, T alpha)
+    {
+        end -= start;
+        return -end * MathCos(alpha * (PiAs<T>() * T(0.5f))) + end + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutSine(T start, T end, T alpha)
+    {
+        end -= start;
+        return end * MathSin(alpha * (PiAs<T>() * T(0.5f))) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutSine(T start, T end, T alpha)
+    {
+        end -= start;
+        return -end * T(0.5f) * (MathCos(PiAs<T>() * alpha) - T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInExpo(T start, T end, T alpha)
+    {
+        end -= start;
+        return end * MathExp2(T(10.0f) * (alpha - T(1.0f))) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutExpo(T start, T end, T alpha)
+    {
+        end -= start;
+        return end * (-MathExp2(T(-10.0f) * alpha) + T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutExpo(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+
+        if (alpha < T(1.0f))
+            return end * T(0.5f) * MathExp2(T(10.0f) * (alpha - T(1.0f))) + start;
+
+        alpha--;
+
+        return end * T(0.5f) * (-MathExp2(T(-10.0f) * alpha) + T(2.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInCirc(T start, T end, T alpha)
+    {
+        end -= start;
+        return -end * (MathSqrt(T(1.0f) - alpha * alpha) - T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutCirc(T start, T end, T alpha)
+    {
+        alpha--;
+        end -= start;
+        return end * MathSqrt(T(1.0f) - alpha * alpha) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutCirc(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+        if (alpha < T(1.0f)) return -end * T(0.5f) * (MathSqrt(T(1.0f) - alpha * alpha) - T(1.0f)) + start;
+        alpha -= T(2.0f);
+        return end * T(0.5f) * (MathSqrt(T(1.0f) - alpha * alpha) + T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutBounce(T start, T end, T alpha)
+    {
+        end -= start;
+        if (alpha < T(1.0f) / T(2.75f))
+        {
+            return end * (T(7.5625f) * alpha * alpha) + start;
+        }
+        else if (alpha < T(2.0f) / T(2.75f))
+        {
+            alpha -= T(1.5f) / T(2.75f);
+            return end * (T(7.5625f) * (alpha) * alpha + T(0.75f)) + start;
+        }
+        else if (alpha < T(2.5f) / T(2.75f))
+        {
+            alpha -= T(2.25f) / T(2.75f);
+            return end * (T(7.5625f) * (alpha) * alpha + T(0.9375f)) + start;
+        }
+        else
+        {
+            alpha -= T(2.625f) / T(2.75f);
+            return end * (T(7.5625f) * (alpha) * alpha + T(0.984375f)) + start;
+        }
+    }
+
+    template<typename T>
+    static constexpr T EaseInBounce(T start, T end, T alpha)
+    {
+        end -= start;
+        const T d = T(1.0f);
+        return end - EaseOutBounce(T(0.0f), end, d - alpha) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutBounce(T start, T end, T alpha)
+    {
+        end -= start;
+        const T d = T(1.0f);
+        if (alpha < d * T(0.5f)) return EaseInBounce(T(0.0f), end, alpha * T(2.0f)) * T(0.5f) + start;
+        else return EaseOutBounce(T(0.0f), end, alpha * T(2.0f) - d) * T(0.5f) + end * T(0.5f) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInBack(T start, T end, T alpha)
+    {
+        end -= start;
+        const T s = T(1.70158L);
+        return end * (alpha) * alpha * ((s + T(1.0f)) * alpha - s) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutBack(T start, T end, T alpha)
+    {
+        const T s = T(1.70158L);
+        end -= start;
+        alpha = (alpha) - T(1.0f);
+        return end * ((alpha) * alpha * ((s + T(1.0f)) * alpha + s) + T(1.0f)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutBack(T start, T end, T alpha)
+    {
+        const T s = T(1.70158L) * T(1.525L);
+        end -= start;
+        alpha /= T(0.5f);
+        if ((alpha) < T(1.0f))
+        {
+            return end * T(0.5f) * (alpha * alpha * (((s) + T(1.0f)) * alpha - s)) + start;
+        }
+        alpha -= T(2.0f);
+        return end * T(0.5f) * ((alpha) * alpha * (((s) + T(1.0f)) * alpha + s) + T(2.0f)) + start;
+    }
+
+    //
+    // The Elastic curves keep the classic amplitude and phase setup: with a = 0 the first branch always runs, so the
+    // curve overshoots by the full range with s = p / 4.
+    //
+    template<typename T>
+    static constexpr T EaseInElastic(T start, T end, T alpha)
+    {
+        end -= start;
+
+        const T d = T(1.0f);
+        const T p = d * T(0.3L);
+        T s = T(0.0f);
+        T a = T(0.0f);
+
+        if (alpha == T(0.0f))
+            return start;
+
+        if ((alpha /= d) == T(1.0f))
+            return start + end;
+
+        if (a == T(0.0f) || a < std::abs(end))
+        {
+            a = end;
+            s = p / T(4.0f);
+        }
+        else
+            s = p / (T(2.0f) * PiAs<T>()) * std::asin(end / a);
+
+        alpha -= T(1.0f);
+
+        return -(a * MathExp2(T(10.0f) * alpha) * MathSin((alpha * d - s) * (T(2.0f) * PiAs<T>()) / p)) + start;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutElastic(T start, T end, T alpha)
+    {
+        end -= start;
+
+        const T d = T(1.0f);
+        const T p = d * T(0.3L);
+        T s = T(0.0f);
+        T a = T(0.0f);
+
+        if (alpha == T(0.0f)) return start;
+
+        if ((alpha /= d) == T(1.0f)) return start + end;
+
+        if (a == T(0.0f) || a < std::abs(end))
+        {
+            a = end;
+            s = p * T(0.25f);
+        }
+        else
+        {
+            s = p / (T(2.0f) * PiAs<T>()) * std::asin(end / a);
+        }
+
+        return (a * MathExp2(T(-10.0f) * alpha) * MathSin((alpha * d - s) * (T(2.0f) * PiAs<T>()) / p) + end + start);
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutElastic(T start, T end, T alpha)
+    {
+        end -= start;
+
+        const T d = T(1.0f);
+        const T p = d * T(0.3L);
+        T s = T(0.0f);
+        T a = T(0.0f);
+
+        if (alpha == T(0.0f)) return start;
+
+        if ((alpha /= d * T(0.5f)) == T(2.0f)) return start + end;
+
+        if (a == T(0.0f) || a < std::abs(end))
+        {
+            a = end;
+            s = p / T(4.0f);
+        }
+        else
+        {
+            s = p / (T(2.0f) * PiAs<T>()) * std::asin(end / a);
+        }
+
+        if (alpha < T(1.0f))
+        {
+            alpha -= T(1.0f);
+            return T(-0.5f) * (a * MathExp2(T(10.0f) * alpha) * MathSin((alpha * d - s) * (T(2.0f) * PiAs<T>()) / p)) + start;
+        }
+
+        alpha -= T(1.0f);
+        return a * MathExp2(T(-10.0f) * alpha) * MathSin((alpha * d - s) * (T(2.0f) * PiAs<T>()) / p) * T(0.5f) + end + start;
+    }
+
+    //
+    // The curves from EaseInOutQuart on used to take floats. These overloads keep calls that mix float with int or
+    // double arguments, e.g. EaseInSine(0, 10, 0.67f), converting as before instead of failing to deduce T.
+    //
+    static constexpr float EaseInOutQuart(float start, float end, float alpha) { return EaseInOutQuart<float>(start, end, alpha); }
+    static constexpr float EaseInQuint(float start, float end, float alpha) { return EaseInQuint<float>(start, end, alpha); }
+    static constexpr float EaseOutQuint(float start, float end, float alpha) { return EaseOutQuint<float>(start, end, alpha); }
+    static constexpr float EaseInOutQuint(float start, float end, float alpha) { return EaseInOutQuint<float>(start, end, alpha); }
+    static constexpr float EaseInSine(float start, float end, float alpha) { return EaseInSine<float>(start, end, alpha); }
+    static constexpr float EaseOutSine(float start, float end, float alpha) { return EaseOutSine<float>(start, end, alpha); }
+    static constexpr float EaseInOutSine(float start, float end, float alpha) { return EaseInOutSine<float>(start, end, alpha); }
+    static constexpr float EaseInExpo(float start, float end, float alpha) { return EaseInExpo<float>(start, end, alpha); }
+    static constexpr float EaseOutExpo(float start, float end, float alpha) { return EaseOutExpo<float>(start, end, alpha); }
+    static constexpr float EaseInOutExpo(float start, float end, float alpha) { return EaseInOutExpo<float>(start, end, alpha); }
+    static constexpr float EaseInCirc(float start, float end, float alpha) { return EaseInCirc<float>(start, end, alpha); }
+    static constexpr float EaseOutCirc(float start, float end, float alpha) { return EaseOutCirc<float>(start, end, alpha); }
+    static constexpr float EaseInOutCirc(float start, float end, float alpha) { return EaseInOutCirc<float>(start, end, alpha); }
+    static constexpr float EaseOutBounce(float start, float end, float alpha) { return EaseOutBounce<float>(start, end, alpha); }
+    static constexpr float EaseInBounce(float start, float end, float alpha) { return EaseInBounce<float>(start, end, alpha); }
+    static constexpr float EaseInOutBounce(float start, float end, float alpha) { return EaseInOutBounce<float>(start, end, alpha); }
+    static constexpr float EaseInBack(float start, float end, float alpha) { return EaseInBack<float>(start, end, alpha); }
+    static constexpr float EaseOutBack(float start, float end, float alpha) { return EaseOutBack<float>(start, end, alpha); }
+    static constexpr float EaseInOutBack(float start, float end, float alpha) { return EaseInOutBack<float>(start, end, alpha); }
+    static constexpr float EaseInElastic(float start, float end, float alpha) { return EaseInElastic<float>(start, end, alpha); }
+    static constexpr float EaseOutElastic(float start, float end, float alpha) { return EaseOutElastic<float>(start, end, alpha); }
+    static constexpr float EaseInOutElastic(float start, float end, float alpha) { return EaseInOutElastic<float>(start, end, alpha); }
+
+    //
+    // These are derived functions that the motor can use to get the speed at a specific time.
+    //
+    // The easing functions all work with a normalized time (0 to 1) and the returned alpha here
+    // reflects that. Values returned here should be divided by the actual time.
+    //
+    // Every derivative agrees with a central difference of its curve away from the Bounce kinks. The Circ
+    // derivatives are infinite where the curve is vertical (alpha = 1 for In, 0 for Out, 0.5 for InOut).
+
+    template<typename T>
+    static constexpr T LinearD(T start, T end, T)
+    {
+        return end - start;
+    }
+
+    template<typename T>
+    static constexpr T EaseInQuadD(T start, T end, T alpha)
+    {
+        return T(2.0f) * (end - start) * alpha;
+    }
+
+    template<typename T>
+    static constexpr T EaseOutQuadD(T start, T end, T alpha)
+    {
+        end -= start;
+        return -end * alpha - end * (alpha - T(2.0f));
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutQuadD(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+
+        if (alpha < T(1.0f))
+        {
+            return T(2.0f) * end * alpha;
+        }
+
+        alpha--;
+
+        return T(2.0f) * end * (T(1.0f) - alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseInCubicD(T start, T end, T alpha)
+    {
+        return T(3.0f) * (end - start) * Pow<2>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseOutCubicD(T start, T end, T alpha)
+    {
+        alpha--;
+        end -= start;
+        return T(3.0f) * end * Pow<2>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutCubicD(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+
+        if (alpha < T(1.0f))
+        {
+            return T(3.0f) * end * Pow<2>(alpha);
+        }
+
+        alpha -= T(2.0f);
+
+        return T(3.0f) * end * Pow<2>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseInQuartD(T start, T end, T alpha)
+    {
+        return T(4.0f) * (end - start) * Pow<3>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseOutQuartD(T start, T end, T alpha)
+    {
+        alpha--;
+        end -= start;
+        return T(-4.0f) * end * Pow<3>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutQuartD(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+
+        if (alpha < T(1.0f))
+        {
+            return T(4.0f) * end * Pow<3>(alpha);
+        }
+
+        alpha -= T(2.0f);
+
+        return T(-4.0f) * end * Pow<3>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseInQuintD(T start, T end, T alpha)
+    {
+        return T(5.0f) * (end - start) * Pow<4>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseOutQuintD(T start, T end, T alpha)
+    {
+        alpha--;
+        end -= start;
+        return T(5.0f) * end * Pow<4>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseInOutQuintD(T start, T end, T alpha)
+    {
+        alpha /= T(0.5f);
+        end -= start;
+
+        if (alpha < T(1.0f))
+        {
+            return T(5.0f) * end * Pow<4>(alpha);
+        }
+
+        alpha -= T(2.0f);
+
+        return T(5.0f) * end * Pow<4>(alpha);
+    }
+
+    template<typename T>
+    static constexpr T EaseInSineD(T start, T end, T alpha)
+    {
+        return (end - start) * T(0.5f) * PiAs<T>() * MathSin(T(0.5f) * PiAs<T>() * alpha);
     }
 
-    static float EaseOutSine(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseOutSineD(T start, T end, T alpha)
     {
         end -= start;
-        return end * std::sin(alpha * (PI * 0.5f)) + start;
+        return (PiAs<T>() * T(0.5f)) * end * MathCos(alpha * (PiAs<T>() * T(0.5f)));
     }
 
-    static float EaseInOutSine(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInOutSineD(T start, T end, T alpha)
     {
         end -= start;
-        return -end * 0.5f * (std::cos(PI * alpha) - 1) + start;
+        return end * T(0.5f) * PiAs<T>() * MathSin(PiAs<T>() * alpha);
     }
 
-    static float EaseInExpo(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInExpoD(T start, T end, T alpha)
     {
-        end -= start;
-        return end * std::pow(2, 10 * (alpha - 1)) + start;
+        return T(10.0f) * NaturalLogOf2As<T>() * (end - start) * MathExp2(T(10.0f) * (alpha - T(1.0f)));
     }
 
-    static float EaseOutExpo(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseOutExpoD(T start, T end, T alpha)
     {
         end -= start;
-        return end * (-std::pow(2, -10 * alpha) + 1) + start;
+        return T(5.0f) * NaturalLogOf2As<T>() * end * MathExp2(T(1.0f) - T(10.0f) * alpha);
     }
 
-    static float EaseInOutExpo(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInOutExpoD(T start, T end, T alpha)
     {
-        alpha /= 0.5f;
+        alpha /= T(0.5f);
         end -= start;
 
-        if (alpha < 1)
-            return end * 0.5f * std::pow(2, 10 * (alpha - 1)) + start;
+        if (alpha < T(1.0f))
+            return T(10.0f) * NaturalLogOf2As<T>() * end * MathExp2(T(10.0f) * (alpha - T(1.0f)));
 
         alpha--;
 
-        return end * 0.5f * (-std::pow(2, -10 * alpha) + 2) + start;
+        return (T(10.0f) * NaturalLogOf2As<T>() * end) / (MathExp2(T(10.0f) * alpha));
+    }
+
+    template<typename T>
+    static constexpr T EaseInCircD(T start, T end, T alpha)
+    {
+        return (end - start) * alpha / MathSqrt(T(1.0f) - alpha * alpha);
     }
 
-    static float EaseInCirc(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseOutCircD(T start, T end, T alpha)
     {
+        alpha--;
         end -= start;
-        return -end * (std::sqrt(1 - alpha * alpha) - 1) + start;
+        return (-end * alpha) / MathSqrt(T(1.0f) - alpha * alpha);
     }
 
-    static float EaseOutCirc(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInOutCircD(T start, T end, T alpha)
     {
-        alpha--;
+        alpha /= T(0.5f);
         end -= start;
-        return end * std::sqrt(1 - alpha * alpha) + start;
+
+        if (alpha < T(1.0f))
+        {
+            return (end * alpha) / MathSqrt(T(1.0f) - alpha * alpha);
+        }
+
+        alpha -= T(2.0f);
+
+        return (-end * alpha) / MathSqrt(T(1.0f) - alpha * alpha);
     }
 
-    static float EaseInOutCirc(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInBounceD(T start, T end, T alpha)
     {
-        alpha /= 0.5f;
         end -= start;
-        if (alpha < 1) return -end * 0.5f * (std::sqrt(1 - alpha * alpha) - 1) + start;
-        alpha -= 2;
-        return end * 0.5f * (std::sqrt(1 - alpha * alpha) + 1) + start;
+        const T d = T(1.0f);
+
+        return EaseOutBounceD(T(0.0f), end, d - alpha);
     }
 
-    static float EaseOutBounce(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseOutBounceD(T start, T end, T alpha)
     {
-        alpha /= 1.0f;
         end -= start;
-        if (alpha < (1 / 2.75f))
+
+        if (alpha < T(1.0f) / T(2.75f))
         {
-            return end * (7.5625f * alpha * alpha) + start;
+            return T(2.0f) * end * T(7.5625f) * alpha;
         }
-        else if (alpha < (2 / 2.75f))
+        else if (alpha < T(2.0f) / T(2.75f))
         {
-            alpha -= (1.5f / 2.75f);
-            return end * (7.5625f * (alpha) * alpha + 0.75f) + start;
+            alpha -= T(1.5f) / T(2.75f);
+            return T(2.0f) * end * T(7.5625f) * alpha;
         }
-        else if (alpha < (2.5 / 2.75))
+        else if (alpha < T(2.5f) / T(2.75f))
         {
-            alpha -= (2.25f / 2.75f);
-            return end * (7.5625f * (alpha) * alpha + .9375f) + start;
+            alpha -= T(2.25f) / T(2.75f);
+            return T(2.0f) * end * T(7.5625f) * alpha;
         }
         else
         {
-            alpha -= (2.625f / 2.75f);
-            return end * (7.5625f * (alpha) * alpha + .984375f) + start;
+            alpha -= T(2.625f) / T(2.75f);
+            return T(2.0f) * end * T(7.5625f) * alpha;
         }
     }
 
-    static float EaseInBounce(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInOutBounceD(T start, T end, T alpha)
     {
         end -= start;
-        float d = 1.0f;
-        return end - EaseOutBounce(0, end, d - alpha) + start;
-    }
+        const T d = T(1.0f);
 
-    static float EaseInOutBounce(float start, float end, float alpha)
-    {
-        end -= start;
-        float d = 1.0f;
-        if (alpha < d * 0.5f) return EaseInBounce(0, end, alpha * 2) * 0.5f + start;
-        else return EaseOutBounce(0, end, alpha * 2 - d) * 0.5f + end * 0.5f + start;
+        return alpha < d * T(0.5f) ? EaseInBounceD(T(0.0f), end, alpha * T(2.0f)) : EaseOutBounceD(T(0.0f), end, alpha * T(2.0f) - d);
     }
 
-    static float EaseInBack(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInBackD(T start, T end, T alpha)
     {
-        end -= start;
-        alpha /= 1;
-        float s = 1.70158f;
-        return end * (alpha) * alpha * ((s + 1) * alpha - s) + start;
+        const T s = T(1.70158L);
+        return T(3.0f) * (s + T(1.0f)) * (end - start) * alpha * alpha - T(2.0f) * s * (end - start) * alpha;
     }
 
-    static float EaseOutBack(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseOutBackD(T start, T end, T alpha)
     {
-        float s = 1.70158f;
+        const T s = T(1.70158L);
         end -= start;
-        alpha = (alpha) - 1;
-        return end * ((alpha) * alpha * ((s + 1) * alpha + s) + 1) + start;
+        alpha = (alpha) - T(1.0f);
+
+        return end * ((s + T(1.0f)) * alpha * alpha + T(2.0f) * alpha * ((s + T(1.0f)) * alpha + s));
     }
 
-    static float EaseInOutBack(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInOutBackD(T start, T end, T alpha)
     {
-        float s = 1.70158f;
+        const T s = T(1.70158L) * T(1.525L);
         end -= start;
-        alpha /= 0.5f;
-        if ((alpha) < 1)
+        alpha /= T(0.5f);
+
+        if ((alpha) < T(1.0f))
         {
-            s *= (1.525f);
-            return end * 0.5f * (alpha * alpha * (((s) + 1) * alpha - s)) + start;
+            return end * (s + T(1.0f)) * alpha * alpha + T(2.0f) * end * alpha * ((s + T(1.0f)) * alpha - s);
         }
-        alpha -= 2;
-        s *= (1.525f);
-        return end * 0.5f * ((alpha) * alpha * (((s) + 1) * alpha + s) + 2) + start;
+
+        alpha -= T(2.0f);
+        return end * ((s + T(1.0f)) * alpha * alpha + T(2.0f) * alpha * ((s + T(1.0f)) * alpha + s));
+    }
+
+    template<typename T>
+    static constexpr T EaseInElasticD(T start, T end, T alpha)
+    {
+        return EaseOutElasticD(start, end, T(1.0f) - alpha);
     }
 
-    static float EaseInElastic(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseOutElasticD(T start, T end, T alpha)
     {
         end -= start;
 
-        float d = 1.0f;
-        float p = d * 0.3f;
-        float s;
-        float a = 0;
-
-        if (alpha == 0)
-            return start;
-
-        if ((alpha /= d) == 1)
-            return start + end;
+        const T d = T(1.0f);
+        const T p = d * T(0.3L);
+        T s = T(0.0f);
+        T a = T(0.0f);
 
-        if (a == 0.0f || a < std::abs(end))
+        if (a == T(0.0f) || a < std::abs(end))
         {
             a = end;
-            s = p / 4;
+            s = p * T(0.25f);
         }
         else
-            s = p / (2 * PI) * std::asin(end / a);
+        {
+            s = p / (T(2.0f) * PiAs<T>()) * std::asin(end / a);
+        }
 
-        return -(a * std::pow(2, 10 * (alpha -= 1)) * std::sin((alpha * d - s) * (2 * PI) / p)) + start;
+        return (a * PiAs<T>() * d * MathExp2(T(1.0f) - T(10.0f) * alpha) *
+            MathCos((T(2.0f) * PiAs<T>() * (d * alpha - s)) / p)) / p - T(5.0f) * NaturalLogOf2As<T>() * a *
+            MathExp2(T(1.0f) - T(10.0f) * alpha) * MathSin((T(2.0f) * PiAs<T>() * (d * alpha - s)) / p);
     }
 
-    static float EaseOutElastic(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T EaseInOutElasticD(T start, T end, T alpha)
     {
         end -= start;
 
-        float d = 1.0f;
-        float p = d * 0.3f;
-        float s;
-        float a = 0;
-
-        if (alpha == 0) return start;
+        const T d = T(1.0f);
+        const T p = d * T(0.3L);
+        T s = T(0.0f);
+        T a = T(0.0f);
 
-        if ((alpha /= d) == 1) return start + end;
-
-        if (a == 0.0f || a < std::abs(end))
+        if (a == T(0.0f) || a < std::abs(end))
         {
             a = end;
-            s = p * 0.25f;
+            s = p / T(4.0f);
         }
         else
         {
-            s = p / (2 * PI) * std::asin(end / a);
+            s = p / (T(2.0f) * PiAs<T>()) * std::asin(end / a);
+        }
+
+        // Same halves as EaseInOutElastic; the 0.5 on each half cancels against the 2 from alpha / (d * 0.5).
+        alpha /= d * T(0.5f);
+
+        if (alpha < T(1.0f))
+        {
+            alpha -= T(1.0f);
+
+            return T(-10.0f) * NaturalLogOf2As<T>() * a * MathExp2(T(10.0f) * alpha) * MathSin(T(2.0f) * PiAs<T>() * (d * alpha - s) / p) -
+                T(2.0f) * a * PiAs<T>() * d * MathExp2(T(10.0f) * alpha) * MathCos(T(2.0f) * PiAs<T>() * (d * alpha - s) / p) / p;
         }
 
-        return (a * std::pow(2, -10 * alpha) * std::sin((alpha * d - s) * (2 * PI) / p) + end + start);
+        alpha -= T(1.0f);
+
+        return T(2.0f) * a * PiAs<T>() * d * MathCos(T(2.0f) * PiAs<T>() * (d * alpha - s) / p) / (p * MathExp2(T(10.0f) * alpha)) -
+            T(10.0f) * NaturalLogOf2As<T>() * a * MathSin(T(2.0f) * PiAs<T>() * (d * alpha - s) / p) / (MathExp2(T(10.0f) * alpha));
     }
 
-    static float EaseInOutElastic(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T SpringD(T start, T end, T alpha)
     {
+        alpha = Clamp(alpha, T(0.0f), T(1.0f));
         end -= start;
 
-        float d = 1.0f;
-        float p = d * 0.3f;
-        float s;
-        float a = 0;
-
-        if (alpha == 0) return start;
+        // EaseSpring is (sin(theta) * (1 - alpha)^2.2 + alpha) * (2.2 - 1.2 * alpha), differentiated with the product rule.
+        const T theta = PiAs<T>() * alpha * (T(0.2L) + T(2.5f) * alpha * alpha * alpha);
+        const T thetaD = PiAs<T>() * (T(0.2L) + T(10.0f) * alpha * alpha * alpha);
+        const T decay = MathPow(T(1.0f) - alpha, T(1.2L));
 
-        if ((alpha /= d * 0.5f) == 2) return start + end;
-
-        if (a == 0.0f || a < std::abs(end))
-        {
-            a = end;
-            s = p / 4;
-        }
-        else
-        {
-            s = p / (2 * PI) * std::asin(end / a);
-        }
+        const T wave = MathSin(theta) * decay * (T(1.0f) - alpha) + alpha;
+        const T waveD = MathCos(theta) * thetaD * decay * (T(1.0f) - alpha) - T(2.2L) * MathSin(theta) * decay + T(1.0f);
 
-        if (alpha < 1) return -0.5f * (a * std::pow(2, 10 * (alpha -= 1)) * std::sin((alpha * d - s) * (2 * PI) / p)) + start;
-        return a * std::pow(2, -10 * (alpha -= 1)) * std::sin((alpha * d - s) * (2 * PI) / p) * 0.5f + end + start;
+        return end * (waveD * (T(2.2L) - T(1.2L) * alpha) - T(1.2L) * wave);
     }
 
     //
-    // These are derived functions that the motor can use to get the speed at a specific time.
+    // Likewise for the derivatives that used to take floats.
     //
-    // The easing functions all work with a normalized time (0 to 1) and the returned alpha here
-    // reflects that. Values returned here should be divided by the actual time.
+    static constexpr float EaseInOutQuadD(float start, float end, float alpha) { return EaseInOutQuadD<float>(start, end, alpha); }
+    static constexpr float EaseInCubicD(float start, float end, float alpha) { return EaseInCubicD<float>(start, end, alpha); }
+    static constexpr float EaseOutCubicD(float start, float end, float alpha) { return EaseOutCubicD<float>(start, end, alpha); }
+    static constexpr float EaseInOutCubicD(float start, float end, float alpha) { return EaseInOutCubicD<float>(start, end, alpha); }
+    static constexpr float EaseInQuartD(float start, float end, float alpha) { return EaseInQuartD<float>(start, end, alpha); }
+    static constexpr float EaseOutQuartD(float start, float end, float alpha) { return EaseOutQuartD<float>(start, end, alpha); }
+    static constexpr float EaseInOutQuartD(float start, float end, float alpha) { return EaseInOutQuartD<float>(start, end, alpha); }
+    static constexpr float EaseInQuintD(float start, float end, float alpha) { return EaseInQuintD<float>(start, end, alpha); }
+    static constexpr float EaseOutQuintD(float start, float end, float alpha) { return EaseOutQuintD<float>(start, end, alpha); }
+    static constexpr float EaseInOutQuintD(float start, float end, float alpha) { return EaseInOutQuintD<float>(start, end, alpha); }
+    static constexpr float EaseInSineD(float start, float end, float alpha) { return EaseInSineD<float>(start, end, alpha); }
+    static constexpr float EaseOutSineD(float start, float end, float alpha) { return EaseOutSineD<float>(start, end, alpha); }
+    static constexpr float EaseInOutSineD(float start, float end, float alpha) { return EaseInOutSineD<float>(start, end, alpha); }
+    static constexpr float EaseInExpoD(float start, float end, float alpha) { return EaseInExpoD<float>(start, end, alpha); }
+    static constexpr float EaseOutExpoD(float start, float end, float alpha) { return EaseOutExpoD<float>(start, end, alpha); }
+    static constexpr float EaseInOutExpoD(float start, float end, float alpha) { return EaseInOutExpoD<float>(start, end, alpha); }
+    static constexpr float EaseInCircD(float start, float end, float alpha) { return EaseInCircD<float>(start, end, alpha); }
+    static constexpr float EaseOutCircD(float start, float end, float alpha) { return EaseOutCircD<float>(start, end, alpha); }
+    static constexpr float EaseInOutCircD(float start, float end, float alpha) { return EaseInOutCircD<float>(start, end, alpha); }
+    static constexpr float EaseInBounceD(float start, float end, float alpha) { return EaseInBounceD<float>(start, end, alpha); }
+    static constexpr float EaseOutBounceD(float start, float end, float alpha) { return EaseOutBounceD<float>(start, end, alpha); }
+    static constexpr float EaseInOutBounceD(float start, float end, float alpha) { return EaseInOutBounceD<float>(start, end, alpha); }
+    static constexpr float EaseInBackD(float start, float end, float alpha) { return EaseInBackD<float>(start, end, alpha); }
+    static constexpr float EaseOutBackD(float start, float end, float alpha) { return EaseOutBackD<float>(start, end, alpha); }
+    static constexpr float EaseInOutBackD(float start, float end, float alpha) { return EaseInOutBackD<float>(start, end, alpha); }
+    static constexpr float EaseInElasticD(float start, float end, float alpha) { return EaseInElasticD<float>(start, end, alpha); }
+    static constexpr float EaseOutElasticD(float start, float end, float alpha) { return EaseOutElasticD<float>(start, end, alpha); }
+    static constexpr float EaseInOutElasticD(float start, float end, float alpha) { return EaseInOutElasticD<float>(start, end, alpha); }
+    static constexpr float SpringD(float start, float end, float alpha) { return SpringD<float>(start, end, alpha); }
+
+    /// Fast math ///
+    //
+    // Branch-free polynomial replacements for the libm calls in the Sine, Expo and Elastic curves. The curves switch to
+    // them when EASING_FAST_MATH is defined; they can also be called directly. Accuracy is that of float, whatever T is.
+    // Maximum error measured against double precision libm:
+    //
+    //   FastSin, FastCos   |x| <= 32           absolute 1.7e-7  (the curves never pass more than |x| ~ 23)
+    //   FastExp2           -126 <= x <= 127    relative 9.5e-8  (~1 ulp); arguments outside are clamped
+    //   FastLog2           normal x > 0        absolute 1.4e-7 on [0.5, 2], relative 9.5e-8 elsewhere
+    //
+    // Over alpha in [0, 1] every curve that uses them stays within 1.8e-7 of its libm result for start = 0, end = 1.
     //
-    // TODO: These functions have not had the testing they deserve. If there is odd behavior around
-    //       dash speeds then this would be the first place I'd look.
 
     template<typename T>
-    static float LinearD(T start, T end, T alpha)
+    static constexpr T FastSin(T x)
     {
-        return end - start;
+        // Reduce to r = x - k * pi in [-pi/2, pi/2] with a three part pi, then sin(x) = (-1)^k * sin(r).
+        const T k = Round(x * T(0.318309886f));
+        const T r = ((x - k * T(3.140625f)) - k * T(9.67502593994140625e-4f)) - k * T(1.509957990978376432e-7f);
+
+        const T p = SinPolynomial(r);
+        return (static_cast<int>(k) & 1) ? -p : p;
     }
 
     template<typename T>
-    static float EaseInQuadD(T start, T end, T alpha)
+    static constexpr T FastCos(T x)
     {
-        return T(2.0f) * (end - start) * alpha;
+        // cos(x) = -(-1)^k * sin(x - (k + 1/2) * pi), with k picked so the remainder lands in [-pi/2, pi/2].
+        const T k = Round(x * T(0.318309886f) - T(0.5f));
+        const T m = k + T(0.5f);
+        const T r = ((x - m * T(3.140625f)) - m * T(9.67502593994140625e-4f)) - m * T(1.509957990978376432e-7f);
+
+        const T p = SinPolynomial(r);
+        return (static_cast<int>(k) & 1) ? p : -p;
     }
 
     template<typename T>
-    static float EaseOutQuadD(T start, T end, T alpha)
+    static constexpr T FastExp2(T x)
     {
-        end -= start;
-        return -end * alpha - end * (alpha - T(2.0f));
+        // 2^x = 2^n * 2^f with n = round(x) and f in [-0.5, 0.5].
+        x = Clamp(x, T(-126.0f), T(127.0f));
+
+        const T n = Round(x);
+        const T f = x - n;
+
+        T p = T(1.535336188319500e-4f);
+        p = p * f + T(1.339887440266574e-3f);
+        p = p * f + T(9.618437357674640e-3f);
+        p = p * f + T(5.550332471162809e-2f);
+        p = p * f + T(2.402264791363012e-1f);
+        p = p * f + T(6.931472028550421e-1f);
+        p = p * f + T(1.0f);
+
+        return ScaleByPowerOfTwo(p, static_cast<int>(n));
     }
 
-    static float EaseInOutQuadD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr T FastLog2(T x)
     {
-        alpha /= 0.5f;
-        end -= start;
+        // x = m * 2^e with m in [sqrt(1/2), sqrt(2)), then log(m) = 2 * atanh((m - 1) / (m + 1)) as an odd series.
+        T e = T(0.0f);
+        T m = SplitExponent(x, e);
 
-        if (alpha < 1)
-        {
-            return end * alpha;
-        }
+        const bool high = m > T(1.41421356f);
+        m = high ? m * T(0.5f) : m;
+        e = high ? e + T(1.0f) : e;
 
-        alpha--;
+        const T s = (m - T(1.0f)) / (m + T(1.0f));
+        const T z = s * s;
+        const T p = T(2.0f) * s * (T(1.0f) + z * (T(1.0f / 3.0f) + z * (T(1.0f / 5.0f) + z * (T(1.0f / 7.0f) + z * T(1.0f / 9.0f)))));
 
-        return end * (1 - alpha);
+        return e + p * T(1.44269504f);
     }
 
-    static float EaseInCubicD(float start, float end, float alpha)
+private:
+    template<typename T>
+    static constexpr T SinPolynomial(T r)
     {
-        return  3.0f * (end - start) * alpha * alpha;
+        // Abramowitz & Stegun 4.3.97, |error| <= 2e-9 on [-pi/2, pi/2].
+        const T z = r * r;
+        return r * (T(1.0f) + z * (T(-0.1666666664f) + z * (T(0.0083333315f) + z * (T(-0.0001984090f) + z * (T(0.0000027526f) + z * T(-0.0000000239f))))));
     }
 
-    static float EaseOutCubicD(float start, float end, float alpha)
+    //
+    // Unit shapes (start = 0, end = 1) with their first two derivatives, for GetEaseWithVelocityFromType. Only the In
+    // shapes are written out (Out for Bounce); the rest follow the same way the eases are built:
+    //
+    //   Out(t)   = 1 - In(1 - t)                      (MirrorSample)
+    //   InOut(t) = In(2t) / 2 below 0.5, Out(2t - 1) / 2 + 1/2 above   (HalfSample)
+    //
+    template<typename T>
+    static constexpr EaseSample<T> MakeSample(T value, T velocity, T acceleration)
     {
-        alpha--;
-        end -= start;
-        return 3.0f * end * alpha * alpha;
+        return EaseSample<T>{ value, velocity, acceleration };
     }
 
-    static float EaseInOutCubicD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr EaseSample<T> MirrorSample(const EaseSample<T>& sample)
     {
-        alpha /= 0.5f;
-        end -= start;
-
-        if (alpha < 1)
-        {
-            return (3.0f / 2.0f) * end * alpha * alpha;
-        }
+        return MakeSample(T(1.0f) - sample.Value, sample.Velocity, -sample.Acceleration);
+    }
 
-        alpha -= 2;
+    template<typename T>
+    static constexpr EaseSample<T> HalfSample(const EaseSample<T>& sample, T alpha)
+    {
+        // Squeezing a shape into half the time doubles the slope and quadruples the curvature; the halved height takes
+        // one factor of 2 back off each.
+        return MakeSample((alpha < T(0.5f) ? T(0.0f) : T(0.5f)) + T(0.5f) * sample.Value, sample.Velocity, T(2.0f) * sample.Acceleration);
+    }
 
-        return (3.0f / 2.0f) * end * alpha * alpha;
+    template<int Exponent, typename T>
+    static constexpr EaseSample<T> SampleInPolynomial(T alpha)
+    {
+        const T a = Pow<Exponent - 2>(alpha);
+        return MakeSample(a * alpha * alpha, T(Exponent) * a * alpha, T(Exponent * (Exponent - 1)) * a);
     }
 
-    static float EaseInQuartD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr EaseSample<T> SampleInSine(T alpha)
     {
-        return 4.0f * (end - start) * alpha * alpha * alpha;
+        const T w = PiAs<T>() * T(0.5f);
+        const T c = MathCos(w * alpha);
+        return MakeSample(T(1.0f) - c, w * MathSin(w * alpha), w * w * c);
     }
 
-    static float EaseOutQuartD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr EaseSample<T> SampleInExpo(T alpha)
     {
-        alpha--;
-        end -= start;
-        return -4.0f * end * alpha * alpha * alpha;
+        const T k = T(10.0f) * NaturalLogOf2As<T>();
+        const T e = MathExp2(T(10.0f) * (alpha - T(1.0f)));
+        return MakeSample(e, k * e, k * k * e);
     }
 
-    static float EaseInOutQuartD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr EaseSample<T> SampleInCirc(T alpha)
     {
-        alpha /= 0.5f;
-        end -= start;
+        const T r = MathSqrt(T(1.0f) - alpha * alpha);
+        return MakeSample(T(1.0f) - r, alpha / r, T(1.0f) / (r * r * r));
+    }
 
-        if (alpha < 1)
-        {
-            return 2.0f * end * alpha * alpha * alpha;
+    template<typename T>
+    static constexpr EaseSample<T> SampleOutBounce(T alpha)
+    {
+        // Four parabolas 7.5625 * (alpha - center)^2 + floor, see EaseOutBounce.
+        T center = T(2.625f) / T(2.75f);
+        T floor = T(0.984375f);
+
+        if (alpha < T(1.0f) / T(2.75f)) {
+            center = T(0.0f);
+            floor = T(0.0f);
+        } else if (alpha < T(2.0f) / T(2.75f)) {
+            center = T(1.5f) / T(2.75f);
+            floor = T(0.75f);
+        } else if (alpha < T(2.5f) / T(2.75f)) {
+            center = T(2.25f) / T(2.75f);
+            floor = T(0.9375f);
         }
 
-        alpha -= 2;
-
-        return -2.0f * end * alpha * alpha * alpha;
+        const T x = alpha - center;
+        return MakeSample(T(7.5625f) * x * x + floor, T(2.0f * 7.5625f) * x, T(2.0f * 7.5625f));
     }
 
-    static float EaseInQuintD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr EaseSample<T> SampleInBack(T alpha, T s)
     {
-        return 5.0f * (end - start) * alpha * alpha * alpha * alpha;
+        return MakeSample(alpha * alpha * ((s + T(1.0f)) * alpha - s),
+            T(3.0f) * (s + T(1.0f)) * alpha * alpha - T(2.0f) * s * alpha,
+            T(6.0f) * (s + T(1.0f)) * alpha - T(2.0f) * s);
     }
 
-    static float EaseOutQuintD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr EaseSample<T> SampleInElastic(T alpha)
     {
-        alpha--;
-        end -= start;
-        return 5.0f * end * alpha * alpha * alpha * alpha;
+        // -2^(10u) * sin(w * (u - s)) with u = alpha - 1, period p = 0.3 and s = p / 4. The value snaps to the end
+        // points like EaseInElastic; the derivatives are those of the unsnapped curve, like EaseInElasticD.
+        const T k = T(10.0f) * NaturalLogOf2As<T>();
+        const T w = T(2.0f) * PiAs<T>() / T(0.3L);
+        const T u = alpha - T(1.0f);
+
+        const T e = MathExp2(T(10.0f) * u);
+        const T sn = MathSin(w * (u - T(0.075L)));
+        const T cs = MathCos(w * (u - T(0.075L)));
+
+        const T value = alpha == T(0.0f) ? T(0.0f) : (alpha == T(1.0f) ? T(1.0f) : -e * sn);
+        return MakeSample(value, -e * (k * sn + w * cs), -e * ((k * k - w * w) * sn + T(2.0f) * k * w * cs));
     }
 
-    static float EaseInOutQuintD(float start, float end, float alpha)
+    template<typename T>
+    static constexpr EaseSample<T> SampleSpring(T alpha)
     {
-        alpha /= 0.5f;
-        end -= start;
+        // (sin(theta) * (1 - alpha)^2.2 + alpha) * (2.2 - 1.2 * alpha), with theta = pi * alpha * (0.2 + 2.5 * alpha^3).
+        // Clamped like EaseSpring, with one Pow for all three powers of (1 - alpha).
+        alpha = Clamp(alpha, T(0.0f), T(1.0f));
 
-        if (alpha < 1)
-        {
-            return (5.0f / 2.0f) * end * alpha * alpha * alpha * alpha;
-        }
+        const T a3 = alpha * alpha * alpha;
+        const T theta = PiAs<T>() * alpha * (T(0.2L) + T(2.5f) * a3);
+        const T thetaD = PiAs<T>() * (T(0.2L) + T(10.0f) * a3);
+        const T thetaDD = T(30.0f) * PiAs<T>() * alpha * alpha;
 
-        alpha -= 2;
+        const T q = T(1.0f) - alpha;
+        const T r = MathPow(q, T(0.2L));
+        const T decay = r * q * q;
+        const T decayD = T(-2.2L) * r * q;
+        const T decayDD = T(2.64L) * r;
 
-        return (5.0f / 2.0f) * end * alpha * alpha * alpha * alpha;
-    }
+        const T sn = MathSin(theta);
+        const T cs = MathCos(theta);
 
-    static float EaseInSineD(float start, float end, float alpha)
-    {
-        return (end - start) * 0.5f * PI * std::sin(0.5f * PI * alpha);
+        const T wave = sn * decay + alpha;
+        const T waveD = cs * thetaD * decay + sn * decayD + T(1.0f);
+        const T waveDD = (cs * thetaDD - sn * thetaD * thetaD) * decay + T(2.0f) * cs * thetaD * decayD + sn * decayDD;
+
+        const T scale = T(2.2L) - T(1.2L) * alpha;
+        return MakeSample(wave * scale, waveD * scale - T(1.2L) * wave, waveDD * scale - T(2.4L) * waveD);
     }
 
-    static float EaseOutSineD(float start, float end, float alpha)
+    //
+    // Inverses of the unit In shapes for GetEaseInverseFromType, each clamping its input to the range of the shape. Out
+    // and InOut follow from them the same way as for the samples above, which is only valid because these curves are
+    // monotonic; Bounce and the searched curves handle their own first crossing.
+    //
+    template<typename T>
+    static T InverseOut(T (*inverseIn)(T), T u)
     {
-        end -= start;
-        return (PI * 0.5f) * end * std::cos(alpha * (PI * 0.5f));
+        return T(1.0f) - inverseIn(T(1.0f) - u);
     }
 
-    static float EaseInOutSineD(float start, float end, float alpha)
+    template<typename T>
+    static T InverseInOut(T (*inverseIn)(T), T u)
     {
-        end -= start;
-        return end * 0.5f * PI * std::sin(PI * alpha);
+        return u < T(0.5f) ? T(0.5f) * inverseIn(T(2.0f) * u) : T(1.0f) - T(0.5f) * inverseIn(T(2.0f) - T(2.0f) * u);
     }
 
-    static float EaseInExpoD(float start, float end, float alpha)
+    template<int Exponent, typename T>
+    static T InverseInPolynomial(T x)
     {
-        return 10.0f * NATURAL_LOG_OF_2 * (end - start) * std::pow(2.0f, 10.0f * (alpha - 1));
+        x = Clamp(x, T(0.0f), T(1.0f));
+
+        switch (Exponent)
+        {
+            case 2:
+                return MathSqrt(x);
+
+            case 3:
+                return std::cbrt(x);
+
+            case 4:
+                return MathSqrt(MathSqrt(x));
+
+            default:
+                return std::pow(x, T(1.0f) / T(Exponent));
+        }
     }
 
-    static float EaseOutExpoD(float start, float end, float alpha)
+    template<typename T>
+    static T InverseInSine(T x)
     {
-        end -= start;
-        return 5.0f * NATURAL_LOG_OF_2 * end * std::pow(2.0f, 1.0f - 10.0f * alpha);
+        // 1 - cos(theta) = 2 * sin^2(theta / 2), which keeps full precision for small x where acos(1 - x) does not.
+        x = Clamp(x, T(0.0f), T(1.0f));
+        return T(4.0f) / PiAs<T>() * std::asin(MathSqrt(T(0.5f) * x));
     }
 
-    static float EaseInOutExpoD(float start, float end, float alpha)
+    template<typename T>
+    static T InverseInExpo(T x)
     {
-        alpha /= 0.5f;
-        end -= start;
-
-        if (alpha < 1)
-            return 5.0f * NATURAL_LOG_OF_2 * end * std::pow(2.0f, 10.0f * (alpha - 1));
-
-        alpha--;
-
-        return (5.0f * NATURAL_LOG_OF_2 * end) / (std::pow(2.0f, 10.0f * alpha));
+        // EaseInExpo starts at 2^-10 rather than 0.
+        x = Clamp(x, T(1.0f / 1024.0f), T(1.0f));
+        return T(1.0f) + T(0.1L) * std::log2(x);
     }
 
-    static float EaseInCircD(float start, float end, float alpha)
+    template<typename T>
+    static T InverseInCirc(T x)
     {
-        return  (end - start) * alpha / std::sqrt(1.0f - alpha * alpha);
+        x = Clamp(x, T(0.0f), T(1.0f));
+        return MathSqrt(x * (T(2.0f) - x));
     }
 
-    static float EaseOutCircD(float start, float end, float alpha)
+    template<typename T>
+    static T InverseOutBounce(T x)
     {
-        alpha--;
-        end -= start;
-        return (-end * alpha) / std::sqrt(1.0f - alpha * alpha);
+        // The first parabola already covers [0, 1).
+        x = Clamp(x, T(0.0f), T(1.0f));
+        return Clamp(MathSqrt(x / T(7.5625f)), T(0.0f), T(1.0f) / T(2.75f));
     }
 
-    static float EaseInOutCircD(float start, float end, float alpha)
+    template<typename T>
+    static T InverseInBounce(T x)
     {
-        alpha /= 0.5f;
-        end -= start;
+        // InBounce(alpha) = 1 - OutBounce(1 - alpha), so its first crossing is the last alpha at which OutBounce reaches
+        // 1 - x: the rising side of the last parabola whose floor lies below 1 - x.
+        static const T centers[4] = { T(0.0f), T(1.5f) / T(2.75f), T(2.25f) / T(2.75f), T(2.625f) / T(2.75f) };
+        static const T floors[4] = { T(0.0f), T(0.75f), T(0.9375f), T(0.984375f) };
 
-        if (alpha < 1)
-        {
-            return (end * alpha) / (2.0f * std::sqrt(1.0f - alpha * alpha));
-        }
+        const T w = T(1.0f) - Clamp(x, T(0.0f), T(1.0f));
+        int i = 3;
 
-        alpha -= 2;
+        while (i > 0 && w < floors[i]) {
+            --i;
+        }
 
-        return (-end * alpha) / (2.0f * std::sqrt(1.0f - alpha * alpha));
+        return T(1.0f) - Clamp(centers[i] + MathSqrt((w - floors[i]) / T(7.5625f)), T(0.0f), T(1.0f));
     }
 
-    static float EaseInBounceD(float start, float end, float alpha)
-    {
-        end -= start;
-        float d = 1.0f;
+    static constexpr int InverseStepCount = 64;
+    static constexpr int InverseBlockSize = 8;
+    static constexpr int InverseBlockCount = InverseStepCount / InverseBlockSize;
+
+    //
+    // Per curve table for InverseBySearch: the curve at the step boundaries, the turning point inside each step that has
+    // one (the step end otherwise), and the value range of every step and of every block of steps, so a query skips
+    // straight to the first step that can contain its value.
+    //
+    template<typename T>
+    struct InverseTable
+    {
+        T StartValue;
+        T Values[InverseStepCount + 1];
+        T TurnAlphas[InverseStepCount];
+        T TurnValues[InverseStepCount];
+        T StepMin[InverseStepCount];
+        T StepMax[InverseStepCount];
+        T BlockMin[InverseBlockCount];
+        T BlockMax[InverseBlockCount];
+        T MinAlpha;
+        T MaxAlpha;
+    };
 
-        return EaseOutBounceD(0, end, d - alpha);
+    template<EEaseType EaseType, typename T>
+    static const InverseTable<T>& GetInverseTable()
+    {
+        static const InverseTable<T> table = MakeInverseTable<T>(EaseType);
+        return table;
     }
 
-    static float EaseOutBounceD(float start, float end, float alpha)
+    template<typename T>
+    static InverseTable<T> MakeInverseTable(EEaseType easeType)
     {
-        alpha /= 1.0f;
-        end -= start;
+        const T step = T(1.0f) / T(InverseStepCount);
 
-        if (alpha < (1 / 2.75f))
-        {
-            return 2.0f * end * 7.5625f * alpha;
-        }
-        else if (alpha < (2 / 2.75f))
-        {
-            alpha -= (1.5f / 2.75f);
-            return 2.0f * end * 7.5625f * alpha;
+        InverseTable<T> table;
+        T velocities[InverseStepCount + 1];
+
+        table.StartValue = GetEaseWithVelocityFromType(easeType, T(0.0f), T(1.0f), T(0.0f)).Value;
+
+        for (int i = 0; i <= InverseStepCount; ++i) {
+            // The Elastic curves snap to their end points. The table holds the curve just inside them instead, so the
+            // first and last steps bracket the crossings that are really there.
+            const T alpha = Clamp(T(i) * step, std::numeric_limits<T>::min(), T(1.0f) - std::numeric_limits<T>::epsilon());
+            const EaseSample<T> sample = GetEaseWithVelocityFromType(easeType, T(0.0f), T(1.0f), alpha);
+            table.Values[i] = sample.Value;
+            velocities[i] = sample.Velocity;
         }
-        else if (alpha < (2.5 / 2.75))
-        {
-            alpha -= (2.25f / 2.75f);
-            return 2.0f * end * 7.5625f * alpha;
+
+        table.MinAlpha = T(0.0f);
+        table.MaxAlpha = T(0.0f);
+        T minValue = table.Values[0];
+        T maxValue = table.Values[0];
+
+        for (int i = 0; i < InverseStepCount; ++i) {
+            table.TurnAlphas[i] = T(i + 1) * step;
+            table.TurnValues[i] = table.Values[i + 1];
+
+            if ((velocities[i] > T(0.0f)) != (velocities[i + 1] > T(0.0f))) {
+                table.TurnAlphas[i] = InverseTurn(easeType, T(i) * step, T(i + 1) * step, velocities[i]);
+                table.TurnValues[i] = GetEaseWithVelocityFromType(easeType, T(0.0f), T(1.0f), table.TurnAlphas[i]).Value;
+            }
+
+            table.StepMin[i] = std::min(std::min(table.Values[i], table.Values[i + 1]), table.TurnValues[i]);
+            table.StepMax[i] = std::max(std::max(table.Values[i], table.Values[i + 1]), table.TurnValues[i]);
+
+            const T candidates[2][2] = { { table.TurnAlphas[i], table.TurnValues[i] }, { T(i + 1) * step, table.Values[i + 1] } };
+
+            for (const auto& candidate : candidates) {
+                if (candidate[1] < minValue) {
+                    table.MinAlpha = candidate[0];
+                    minValue = candidate[1];
+                }
+
+                if (candidate[1] > maxValue) {
+                    table.MaxAlpha = candidate[0];
+                    maxValue = candidate[1];
+                }
+            }
         }
-        else
-        {
-            alpha -= (2.625f / 2.75f);
-            return 2.0f * end * 7.5625f * alpha;
+
+        for (int block = 0; block < InverseBlockCount; ++block) {
+            const int first = block * InverseBlockSize;
+            table.BlockMin[block] = *std::min_element(table.StepMin + first, table.StepMin + first + InverseBlockSize);
+            table.BlockMax[block] = *std::max_element(table.StepMax + first, table.StepMax + first + InverseBlockSize);
         }
+
+        return table;
     }
 
-    static float EaseInOutBounceD(float start, float end, float alpha)
+    //
+    // First crossing of a non-monotonic unit curve: the first block, then the first step in it, whose range contains u,
+    // and then the part of that step before or after its turning point. A value the curve never reaches gives the alpha
+    // of its lowest or highest point.
+    //
+    template<EEaseType EaseType, typename T>
+    static T InverseBySearch(T u)
     {
-        end -= start;
-        float d = 1.0f;
+        const InverseTable<T>& table = GetInverseTable<EaseType, T>();
+        const T step = T(1.0f) / T(InverseStepCount);
 
-        return alpha < d * 0.5f ? EaseInBounceD(0, end, alpha * 2) * 0.5f : EaseOutBounceD(0, end, alpha * 2 - d) * 0.5f;
-    }
+        if (table.StartValue == u) {
+            return T(0.0f);
+        }
 
-    static float EaseInBackD(float start, float end, float alpha)
-    {
-        const float s = 1.70158f;
-        return 3.0f * (s + 1.0f) * (end - start) * alpha * alpha - 2.0f * s * (end - start) * alpha;
-    }
+        for (int block = 0; block < InverseBlockCount; ++block) {
+            if (u < table.BlockMin[block] || u > table.BlockMax[block]) {
+                continue;
+            }
 
-    static float EaseOutBackD(float start, float end, float alpha)
-    {
-        const float s = 1.70158f;
-        end -= start;
-        alpha = (alpha) - 1;
+            for (int i = block * InverseBlockSize; i < (block + 1) * InverseBlockSize; ++i) {
+                if (u < table.StepMin[i] || u > table.StepMax[i]) {
+                    continue;
+                }
 
-        return end * ((s + 1.0f) * alpha * alpha + 2.0f * alpha * ((s + 1.0f) * alpha + s));
-    }
+                const T turn = table.TurnAlphas[i];
+                const T f0 = table.Values[i] - u;
+                const T fTurn = table.TurnValues[i] - u;
 
-    static float EaseInOutBackD(float start, float end, float alpha)
-    {
-        float s = 1.70158f;
-        end -= start;
-        alpha /= 0.5f;
+                if ((f0 <= T(0.0f)) == (fTurn >= T(0.0f)) || f0 == T(0.0f)) {
+                    return InverseRefine(EaseType, T(i) * step, turn, f0, fTurn, u);
+                }
 
-        if ((alpha) < 1)
-        {
-            s *= (1.525f);
-            return 0.5f * end * (s + 1) * alpha * alpha + end * alpha * ((s + 1.0f) * alpha - s);
+                return InverseRefine(EaseType, turn, T(i + 1) * step, fTurn, table.Values[i + 1] - u, u);
+            }
         }
 
-        alpha -= 2;
-        s *= (1.525f);
-        return 0.5f * end * ((s + 1) * alpha * alpha + 2.0f * alpha * ((s + 1.0f) * alpha + s));
+        return u < table.Values[0] ? table.MinAlpha : table.MaxAlpha;
     }
 
-    static float EaseInElasticD(float start, float end, float alpha)
+    //
+    // Halley's method on ease(alpha) - u, kept inside [a0, a1] where it changes sign. A step that would leave the
+    // bracket is replaced by a bisection, so it always converges even where the slope vanishes.
+    //
+    template<typename T>
+    static T InverseRefine(EEaseType easeType, T a0, T a1, T f0, T f1, T u)
     {
-        return EaseOutElasticD(start, end, 1.0f - alpha);
-    }
+        if (f0 == T(0.0f)) {
+            return a0;
+        }
 
-    static float EaseOutElasticD(float start, float end, float alpha)
-    {
-        end -= start;
+        if (f1 == T(0.0f)) {
+            return a1;
+        }
 
-        float d = 1.0f;
-        float p = d * 0.3f;
-        float s;
-        float a = 0;
+        T alpha = a0 + (a1 - a0) * f0 / (f0 - f1);
 
-        if (a == 0.0f || a < std::abs(end))
-        {
-            a = end;
-            s = p * 0.25f;
-        }
-        else
-        {
-            s = p / (2 * PI) * std::asin(end / a);
+        for (int i = 0; i < 32; ++i) {
+            const EaseSample<T> sample = GetEaseWithVelocityFromType(easeType, T(0.0f), T(1.0f), alpha);
+            const T f = sample.Value - u;
+
+            if (f == T(0.0f)) {
+                return alpha;
+            }
+
+            if ((f < T(0.0f)) == (f0 < T(0.0f))) {
+                a0 = alpha;
+            } else {
+                a1 = alpha;
+            }
+
+            const T denominator = T(2.0f) * sample.Velocity * sample.Velocity - f * sample.Acceleration;
+            T next = denominator != T(0.0f) ? alpha - T(2.0f) * f * sample.Velocity / denominator : a0;
+
+            if (std::fabs(next - alpha) <= std::numeric_limits<T>::epsilon() * T(0.5f) && next >= a0 && next <= a1) {
+                return next;
+            }
+
+            if (!(next > a0 && next < a1)) {
+                next = T(0.5f) * (a0 + a1);
+            }
+
+            alpha = next;
         }
 
-        return (a * PI * d * std::pow(2.0f, 1.0f - 10.0f * alpha) *
-            std::cos((2.0f * PI * (d * alpha - s)) / p)) / p - 5.0f * NATURAL_LOG_OF_2 * a *
-            std::pow(2.0f, 1.0f - 10.0f * alpha) * std::sin((2.0f * PI * (d * alpha - s)) / p);
+        return alpha;
     }
 
-    static float EaseInOutElasticD(float start, float end, float alpha)
+    //
+    // Newton's method on the slope, for the turning point inside [a0, a1] where the slope goes from the sign of v0 to
+    // the other one.
+    //
+    template<typename T>
+    static T InverseTurn(EEaseType easeType, T a0, T a1, T v0)
     {
-        end -= start;
+        T alpha = T(0.5f) * (a0 + a1);
 
-        float d = 1.0f;
-        float p = d * 0.3f;
-        float s;
-        float a = 0;
+        for (int i = 0; i < 32; ++i) {
+            const EaseSample<T> sample = GetEaseWithVelocityFromType(easeType, T(0.0f), T(1.0f), alpha);
 
-        if (a == 0.0f || a < std::abs(end))
-        {
-            a = end;
-            s = p / 4;
-        }
-        else
-        {
-            s = p / (2 * PI) * std::asin(end / a);
-        }
+            if (sample.Velocity == T(0.0f)) {
+                return alpha;
+            }
 
-        if (alpha < 1)
-        {
-            alpha -= 1;
+            if ((sample.Velocity > T(0.0f)) == (v0 > T(0.0f))) {
+                a0 = alpha;
+            } else {
+                a1 = alpha;
+            }
 
-            return -5.0f * NATURAL_LOG_OF_2 * a * std::pow(2.0f, 10.0f * alpha) * std::sin(2 * PI * (d * alpha - 2.0f) / p) -
-                a * PI * d * std::pow(2.0f, 10.0f * alpha) * std::cos(2 * PI * (d * alpha - s) / p) / p;
-        }
+            T next = sample.Acceleration != T(0.0f) ? alpha - sample.Velocity / sample.Acceleration : a0;
+
+            if (std::fabs(next - alpha) <= std::numeric_limits<T>::epsilon() * T(0.5f) && next >= a0 && next <= a1) {
+                return next;
+            }
+
+            if (!(next > a0 && next < a1)) {
+                next = T(0.5f) * (a0 + a1);
+            }
 
-        alpha -= 1;
+            alpha = next;
+        }
 
-        return a * PI * d * std::cos(2.0f * PI * (d * alpha - s) / p) / (p * std::pow(2.0f, 10.0f * alpha)) -
-            5.0f * NATURAL_LOG_OF_2 * a * std::sin(2.0f * PI * (d * alpha - s) / p) / (std::pow(2.0f, 10.0f * alpha));
+        return alpha;
     }
+};
 
-    static float SpringD(float start, float end, float alpha)
-    {
-        alpha = Clamp(alpha, 0.0f, 1.0f);
-        end -= start;
+template<typename T>
+struct EasingFunctionTable
+{
+    static constexpr EasingFunctions::EasingFunc<T> Eases[EasingFunctions::EASE_TYPE_COUNT] =
+    {
+        &EasingFunctions::Ease<EasingFunctions::EASE_LINEAR, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_SPRING, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_QUAD, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_QUAD, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_QUAD, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_CUBIC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_CUBIC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_CUBIC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_QUART, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_QUART, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_QUART, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_QUINT, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_QUINT, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_QUINT, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_SINE, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_SINE, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_SINE, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_EXPO, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_EXPO, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_EXPO, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_CIRC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_CIRC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_CIRC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_BOUNCE, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_BOUNCE, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_BOUNCE, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_BACK, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_BACK, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_BACK, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_ELASTIC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_OUT_ELASTIC, T>,
+        &EasingFunctions::Ease<EasingFunctions::EASE_IN_OUT_ELASTIC, T>
+    };
+
+    static constexpr EasingFunctions::EasingFunc<T> Derivatives[EasingFunctions::EASE_TYPE_COUNT] =
+    {
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_LINEAR, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_SPRING, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_QUAD, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_QUAD, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_QUAD, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_CUBIC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_CUBIC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_CUBIC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_QUART, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_QUART, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_QUART, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_QUINT, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_QUINT, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_QUINT, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_SINE, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_SINE, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_SINE, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_EXPO, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_EXPO, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_EXPO, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_CIRC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_CIRC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_CIRC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_BOUNCE, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_BOUNCE, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_BOUNCE, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_BACK, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_BACK, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_BACK, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_ELASTIC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_OUT_ELASTIC, T>,
+        &EasingFunctions::EaseDerivative<EasingFunctions::EASE_IN_OUT_ELASTIC, T>
+    };
+};
 
-        // Damn... Thanks http://www.derivative-calculator.net/
-        // TODO: And it's a little bit wrong
-        return end * (6.0f * (1.0f - alpha) / 5.0f + 1.0f) * (-2.0f * std::pow(1.0f - alpha, 1.2f) *
-            std::sin(PI * alpha * (2.5f * alpha * alpha * alpha + 0.2f)) + std::pow(1.0f - alpha, 2.2f) *
-            (PI * (2.5f * alpha * alpha * alpha + 0.2f) + 7.5f * PI * alpha * alpha * alpha) *
-            std::cos(PI * alpha * (2.5f * alpha * alpha * alpha + 0.2f)) + 1.0f) -
-            6.0f * end * (std::pow(1 - alpha, 2.2f) * std::sin(PI * alpha * (2.5f * alpha * alpha * alpha + 0.2f)) + alpha
-            / 5.0f);
+template<typename T>
+constexpr EasingFunctions::EasingFunc<T> EasingFunctionTable<T>::Eases[EasingFunctions::EASE_TYPE_COUNT];
 
-    }
-};
\ No newline at end of file
+template<typename T>
+constexpr EasingFunctions::EasingFunc<T> EasingFunctionTable<T>::Derivatives[EasingFunctions::EASE_TYPE_COUNT];
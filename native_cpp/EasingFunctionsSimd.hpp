@@ -0,0 +1,1151 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * SIMD kernels for the curves in EasingFunctions.hpp. Every curve is written once against a small "lane" interface
+ * and instantiated for scalar, SSE2, AVX2, AVX-512 and NEON (AArch64) lanes, evaluating 1/4/8/16/4 floats at a time.
+ * Piecewise curves compute every segment and blend the results with masks instead of branching per lane.
+ *
+ * The Sine, Expo and Elastic kernels use lane versions of EasingFunctions::FastSin/FastCos/FastExp2 whether or not
+ * EASING_FAST_MATH is defined, so they stay in lanes too. They are within 1.8e-7 of the libm curves (start = 0,
+ * end = 1), which is also how far the scalar curves move with EASING_FAST_MATH.
+ *
+ * float start[N], end[N], alpha[N], out[N];
+ *
+ * EasingFunctionsSimd::GetEaseFromTypeBatch(EasingFunctions::EASE_OUT_BOUNCE, start, end, alpha, out, N);
+ *
+ * GetCubicBezierBatch does the same for an EasingCubicBezier. Looking up the cached seeds is a gather, so it runs in a
+ * scalar pass over each block of 64 alphas, and the seed, Halley step and y(t) run in lanes.
+ *
+ * GetEaseFromTypeBatch picks the widest kernel that is both available in the binary and supported by the CPU it is
+ * running on. By default only the lanes enabled by the compiler flags of the including translation unit are
+ * available (e.g. -mavx2 for AVX2). To ship one binary that uses AVX2/AVX-512 when present, define
+ * EASING_SIMD_DISPATCH_UNITS everywhere and link the per-ISA units in native_cpp/simd/, each compiled with its own
+ * instruction set flags.
+ */
+
+#pragma once
+
+#include "EasingCubicBezier.hpp"
+#include "EasingFunctions.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define EASING_SIMD_X86 1
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define EASING_SIMD_ARM64 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define EASING_SIMD_HAS_SSE2 1
+    #include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+    #define EASING_SIMD_HAS_AVX2 1
+#endif
+
+#if defined(__AVX512F__)
+    #define EASING_SIMD_HAS_AVX512 1
+#endif
+
+#if defined(EASING_SIMD_HAS_AVX2) || defined(EASING_SIMD_HAS_AVX512)
+    #include <immintrin.h>
+#endif
+
+#if defined(EASING_SIMD_ARM64) && (defined(__ARM_NEON) || defined(_M_ARM64))
+    #define EASING_SIMD_HAS_NEON 1
+    #include <arm_neon.h>
+#endif
+
+#if defined(EASING_SIMD_X86) && defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+//
+// Lane types. Each one wraps a native register and exposes the same handful of operations the kernels need.
+// Masks are whatever the instruction set compares into; they are only ever passed back to Select.
+// Round goes to the nearest integer (ties to even) and Exp2Int builds 2^n from an integral n in [-126, 127].
+// SplitExponent returns the mantissa of a normal float in [1, 2) and its unbiased exponent.
+//
+
+struct EaseLaneScalar
+{
+    typedef bool Mask;
+    static const std::size_t Width = 1;
+
+    float Value;
+
+    static EaseLaneScalar Set(float value) { return { value }; }
+    static EaseLaneScalar Load(const float* src) { return { *src }; }
+    void Store(float* dst) const { *dst = Value; }
+
+    static Mask Less(EaseLaneScalar a, EaseLaneScalar b) { return a.Value < b.Value; }
+    static Mask Equal(EaseLaneScalar a, EaseLaneScalar b) { return a.Value == b.Value; }
+    static EaseLaneScalar Select(Mask mask, EaseLaneScalar a, EaseLaneScalar b) { return mask ? a : b; }
+
+    static EaseLaneScalar Min(EaseLaneScalar a, EaseLaneScalar b) { return { a.Value < b.Value ? a.Value : b.Value }; }
+    static EaseLaneScalar Max(EaseLaneScalar a, EaseLaneScalar b) { return { a.Value > b.Value ? a.Value : b.Value }; }
+    static EaseLaneScalar Sqrt(EaseLaneScalar a) { return { std::sqrt(a.Value) }; }
+
+    static EaseLaneScalar Round(EaseLaneScalar a) { return { std::nearbyint(a.Value) }; }
+
+    static EaseLaneScalar Exp2Int(EaseLaneScalar n)
+    {
+        const std::uint32_t bits = std::uint32_t(static_cast<int>(n.Value) + 127) << 23;
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return { value };
+    }
+
+    static EaseLaneScalar SplitExponent(EaseLaneScalar a, EaseLaneScalar& exponent)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &a.Value, sizeof(bits));
+        exponent.Value = float(int((bits >> 23) & 0xff) - 127);
+        bits = (bits & 0x007fffffu) | 0x3f800000u;
+        float mantissa;
+        std::memcpy(&mantissa, &bits, sizeof(mantissa));
+        return { mantissa };
+    }
+
+    friend EaseLaneScalar operator+(EaseLaneScalar a, EaseLaneScalar b) { return { a.Value + b.Value }; }
+    friend EaseLaneScalar operator-(EaseLaneScalar a, EaseLaneScalar b) { return { a.Value - b.Value }; }
+    friend EaseLaneScalar operator*(EaseLaneScalar a, EaseLaneScalar b) { return { a.Value * b.Value }; }
+    friend EaseLaneScalar operator/(EaseLaneScalar a, EaseLaneScalar b) { return { a.Value / b.Value }; }
+    friend EaseLaneScalar operator-(EaseLaneScalar a) { return { -a.Value }; }
+};
+
+#if defined(EASING_SIMD_HAS_SSE2)
+struct EaseLaneSse2
+{
+    typedef __m128 Mask;
+    static const std::size_t Width = 4;
+
+    __m128 Value;
+
+    static EaseLaneSse2 Set(float value) { return { _mm_set1_ps(value) }; }
+    static EaseLaneSse2 Load(const float* src) { return { _mm_loadu_ps(src) }; }
+    void Store(float* dst) const { _mm_storeu_ps(dst, Value); }
+
+    static Mask Less(EaseLaneSse2 a, EaseLaneSse2 b) { return _mm_cmplt_ps(a.Value, b.Value); }
+    static Mask Equal(EaseLaneSse2 a, EaseLaneSse2 b) { return _mm_cmpeq_ps(a.Value, b.Value); }
+    static EaseLaneSse2 Select(Mask mask, EaseLaneSse2 a, EaseLaneSse2 b)
+    {
+        return { _mm_or_ps(_mm_and_ps(mask, a.Value), _mm_andnot_ps(mask, b.Value)) };
+    }
+
+    static EaseLaneSse2 Min(EaseLaneSse2 a, EaseLaneSse2 b) { return { _mm_min_ps(a.Value, b.Value) }; }
+    static EaseLaneSse2 Max(EaseLaneSse2 a, EaseLaneSse2 b) { return { _mm_max_ps(a.Value, b.Value) }; }
+    static EaseLaneSse2 Sqrt(EaseLaneSse2 a) { return { _mm_sqrt_ps(a.Value) }; }
+
+    static EaseLaneSse2 Round(EaseLaneSse2 a) { return { _mm_cvtepi32_ps(_mm_cvtps_epi32(a.Value)) }; }
+
+    static EaseLaneSse2 Exp2Int(EaseLaneSse2 n)
+    {
+        return { _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n.Value), _mm_set1_epi32(127)), 23)) };
+    }
+
+    static EaseLaneSse2 SplitExponent(EaseLaneSse2 a, EaseLaneSse2& exponent)
+    {
+        const __m128i bits = _mm_castps_si128(a.Value);
+        exponent.Value = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xff)), _mm_set1_epi32(127)));
+        return { _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000))) };
+    }
+
+    friend EaseLaneSse2 operator+(EaseLaneSse2 a, EaseLaneSse2 b) { return { _mm_add_ps(a.Value, b.Value) }; }
+    friend EaseLaneSse2 operator-(EaseLaneSse2 a, EaseLaneSse2 b) { return { _mm_sub_ps(a.Value, b.Value) }; }
+    friend EaseLaneSse2 operator*(EaseLaneSse2 a, EaseLaneSse2 b) { return { _mm_mul_ps(a.Value, b.Value) }; }
+    friend EaseLaneSse2 operator/(EaseLaneSse2 a, EaseLaneSse2 b) { return { _mm_div_ps(a.Value, b.Value) }; }
+    friend EaseLaneSse2 operator-(EaseLaneSse2 a) { return { _mm_xor_ps(a.Value, _mm_set1_ps(-0.0f)) }; }
+};
+#endif
+
+#if defined(EASING_SIMD_HAS_AVX2)
+struct EaseLaneAvx2
+{
+    typedef __m256 Mask;
+    static const std::size_t Width = 8;
+
+    __m256 Value;
+
+    static EaseLaneAvx2 Set(float value) { return { _mm256_set1_ps(value) }; }
+    static EaseLaneAvx2 Load(const float* src) { return { _mm256_loadu_ps(src) }; }
+    void Store(float* dst) const { _mm256_storeu_ps(dst, Value); }
+
+    static Mask Less(EaseLaneAvx2 a, EaseLaneAvx2 b) { return _mm256_cmp_ps(a.Value, b.Value, _CMP_LT_OQ); }
+    static Mask Equal(EaseLaneAvx2 a, EaseLaneAvx2 b) { return _mm256_cmp_ps(a.Value, b.Value, _CMP_EQ_OQ); }
+    static EaseLaneAvx2 Select(Mask mask, EaseLaneAvx2 a, EaseLaneAvx2 b) { return { _mm256_blendv_ps(b.Value, a.Value, mask) }; }
+
+    static EaseLaneAvx2 Min(EaseLaneAvx2 a, EaseLaneAvx2 b) { return { _mm256_min_ps(a.Value, b.Value) }; }
+    static EaseLaneAvx2 Max(EaseLaneAvx2 a, EaseLaneAvx2 b) { return { _mm256_max_ps(a.Value, b.Value) }; }
+    static EaseLaneAvx2 Sqrt(EaseLaneAvx2 a) { return { _mm256_sqrt_ps(a.Value) }; }
+
+    static EaseLaneAvx2 Round(EaseLaneAvx2 a) { return { _mm256_round_ps(a.Value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+
+    static EaseLaneAvx2 Exp2Int(EaseLaneAvx2 n)
+    {
+        return { _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(n.Value), _mm256_set1_epi32(127)), 23)) };
+    }
+
+    static EaseLaneAvx2 SplitExponent(EaseLaneAvx2 a, EaseLaneAvx2& exponent)
+    {
+        const __m256i bits = _mm256_castps_si256(a.Value);
+        exponent.Value = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xff)), _mm256_set1_epi32(127)));
+        return { _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000))) };
+    }
+
+    friend EaseLaneAvx2 operator+(EaseLaneAvx2 a, EaseLaneAvx2 b) { return { _mm256_add_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx2 operator-(EaseLaneAvx2 a, EaseLaneAvx2 b) { return { _mm256_sub_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx2 operator*(EaseLaneAvx2 a, EaseLaneAvx2 b) { return { _mm256_mul_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx2 operator/(EaseLaneAvx2 a, EaseLaneAvx2 b) { return { _mm256_div_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx2 operator-(EaseLaneAvx2 a) { return { _mm256_xor_ps(a.Value, _mm256_set1_ps(-0.0f)) }; }
+};
+#endif
+
+#if defined(EASING_SIMD_HAS_AVX512)
+struct EaseLaneAvx512
+{
+    typedef __mmask16 Mask;
+    static const std::size_t Width = 16;
+
+    __m512 Value;
+
+    static EaseLaneAvx512 Set(float value) { return { _mm512_set1_ps(value) }; }
+    static EaseLaneAvx512 Load(const float* src) { return { _mm512_loadu_ps(src) }; }
+    void Store(float* dst) const { _mm512_storeu_ps(dst, Value); }
+
+    static Mask Less(EaseLaneAvx512 a, EaseLaneAvx512 b) { return _mm512_cmp_ps_mask(a.Value, b.Value, _CMP_LT_OQ); }
+    static Mask Equal(EaseLaneAvx512 a, EaseLaneAvx512 b) { return _mm512_cmp_ps_mask(a.Value, b.Value, _CMP_EQ_OQ); }
+    static EaseLaneAvx512 Select(Mask mask, EaseLaneAvx512 a, EaseLaneAvx512 b) { return { _mm512_mask_blend_ps(mask, b.Value, a.Value) }; }
+
+    static EaseLaneAvx512 Min(EaseLaneAvx512 a, EaseLaneAvx512 b) { return { _mm512_min_ps(a.Value, b.Value) }; }
+    static EaseLaneAvx512 Max(EaseLaneAvx512 a, EaseLaneAvx512 b) { return { _mm512_max_ps(a.Value, b.Value) }; }
+    static EaseLaneAvx512 Sqrt(EaseLaneAvx512 a) { return { _mm512_sqrt_ps(a.Value) }; }
+
+    static EaseLaneAvx512 Round(EaseLaneAvx512 a) { return { _mm512_roundscale_ps(a.Value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+
+    static EaseLaneAvx512 Exp2Int(EaseLaneAvx512 n)
+    {
+        return { _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(n.Value), _mm512_set1_epi32(127)), 23)) };
+    }
+
+    static EaseLaneAvx512 SplitExponent(EaseLaneAvx512 a, EaseLaneAvx512& exponent)
+    {
+        const __m512i bits = _mm512_castps_si512(a.Value);
+        exponent.Value = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_and_si512(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(0xff)), _mm512_set1_epi32(127)));
+        return { _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f800000))) };
+    }
+
+    friend EaseLaneAvx512 operator+(EaseLaneAvx512 a, EaseLaneAvx512 b) { return { _mm512_add_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx512 operator-(EaseLaneAvx512 a, EaseLaneAvx512 b) { return { _mm512_sub_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx512 operator*(EaseLaneAvx512 a, EaseLaneAvx512 b) { return { _mm512_mul_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx512 operator/(EaseLaneAvx512 a, EaseLaneAvx512 b) { return { _mm512_div_ps(a.Value, b.Value) }; }
+    friend EaseLaneAvx512 operator-(EaseLaneAvx512 a) { return { _mm512_sub_ps(_mm512_setzero_ps(), a.Value) }; }
+};
+#endif
+
+#if defined(EASING_SIMD_HAS_NEON)
+struct EaseLaneNeon
+{
+    typedef uint32x4_t Mask;
+    static const std::size_t Width = 4;
+
+    float32x4_t Value;
+
+    static EaseLaneNeon Set(float value) { return { vdupq_n_f32(value) }; }
+    static EaseLaneNeon Load(const float* src) { return { vld1q_f32(src) }; }
+    void Store(float* dst) const { vst1q_f32(dst, Value); }
+
+    static Mask Less(EaseLaneNeon a, EaseLaneNeon b) { return vcltq_f32(a.Value, b.Value); }
+    static Mask Equal(EaseLaneNeon a, EaseLaneNeon b) { return vceqq_f32(a.Value, b.Value); }
+    static EaseLaneNeon Select(Mask mask, EaseLaneNeon a, EaseLaneNeon b) { return { vbslq_f32(mask, a.Value, b.Value) }; }
+
+    static EaseLaneNeon Min(EaseLaneNeon a, EaseLaneNeon b) { return { vminq_f32(a.Value, b.Value) }; }
+    static EaseLaneNeon Max(EaseLaneNeon a, EaseLaneNeon b) { return { vmaxq_f32(a.Value, b.Value) }; }
+    static EaseLaneNeon Sqrt(EaseLaneNeon a) { return { vsqrtq_f32(a.Value) }; }
+
+    static EaseLaneNeon Round(EaseLaneNeon a) { return { vrndnq_f32(a.Value) }; }
+
+    static EaseLaneNeon Exp2Int(EaseLaneNeon n)
+    {
+        return { vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtnq_s32_f32(n.Value), vdupq_n_s32(127)), 23)) };
+    }
+
+    static EaseLaneNeon SplitExponent(EaseLaneNeon a, EaseLaneNeon& exponent)
+    {
+        const uint32x4_t bits = vreinterpretq_u32_f32(a.Value);
+        exponent.Value = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vandq_u32(vshrq_n_u32(bits, 23), vdupq_n_u32(0xff))), vdupq_n_s32(127)));
+        return { vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007fffff)), vdupq_n_u32(0x3f800000))) };
+    }
+
+    friend EaseLaneNeon operator+(EaseLaneNeon a, EaseLaneNeon b) { return { vaddq_f32(a.Value, b.Value) }; }
+    friend EaseLaneNeon operator-(EaseLaneNeon a, EaseLaneNeon b) { return { vsubq_f32(a.Value, b.Value) }; }
+    friend EaseLaneNeon operator*(EaseLaneNeon a, EaseLaneNeon b) { return { vmulq_f32(a.Value, b.Value) }; }
+    friend EaseLaneNeon operator/(EaseLaneNeon a, EaseLaneNeon b) { return { vdivq_f32(a.Value, b.Value) }; }
+    friend EaseLaneNeon operator-(EaseLaneNeon a) { return { vnegq_f32(a.Value) }; }
+};
+#endif
+
+class EasingFunctionsSimd
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    enum ESimdLevel : unsigned int
+    {
+        SIMD_LEVEL_SCALAR = 0,
+        SIMD_LEVEL_SSE2,
+        SIMD_LEVEL_NEON,
+        SIMD_LEVEL_AVX2,
+        SIMD_LEVEL_AVX512
+    };
+
+    //
+    // The widest kernel GetEaseFromTypeBatch will use on this machine. Detected once and cached.
+    //
+    static ESimdLevel GetSimdLevel()
+    {
+        static const ESimdLevel level = DetectSimdLevel();
+        return level;
+    }
+
+    static void GetEaseFromTypeBatch(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+    {
+        switch (GetSimdLevel())
+        {
+#if defined(EASING_SIMD_DISPATCH_UNITS) && defined(EASING_SIMD_X86)
+            case SIMD_LEVEL_AVX512:
+                return GetEaseFromTypeBatchAvx512(easeType, start, end, alpha, out, count);
+
+            case SIMD_LEVEL_AVX2:
+                return GetEaseFromTypeBatchAvx2(easeType, start, end, alpha, out, count);
+
+            case SIMD_LEVEL_SSE2:
+                return GetEaseFromTypeBatchSse2(easeType, start, end, alpha, out, count);
+#elif defined(EASING_SIMD_DISPATCH_UNITS) && defined(EASING_SIMD_ARM64)
+            case SIMD_LEVEL_NEON:
+                return GetEaseFromTypeBatchNeon(easeType, start, end, alpha, out, count);
+#else
+    #if defined(EASING_SIMD_HAS_AVX512)
+            case SIMD_LEVEL_AVX512:
+                return GetEaseFromTypeLanes<EaseLaneAvx512>(easeType, start, end, alpha, out, count);
+    #endif
+    #if defined(EASING_SIMD_HAS_AVX2)
+            case SIMD_LEVEL_AVX2:
+                return GetEaseFromTypeLanes<EaseLaneAvx2>(easeType, start, end, alpha, out, count);
+    #endif
+    #if defined(EASING_SIMD_HAS_SSE2)
+            case SIMD_LEVEL_SSE2:
+                return GetEaseFromTypeLanes<EaseLaneSse2>(easeType, start, end, alpha, out, count);
+    #endif
+    #if defined(EASING_SIMD_HAS_NEON)
+            case SIMD_LEVEL_NEON:
+                return GetEaseFromTypeLanes<EaseLaneNeon>(easeType, start, end, alpha, out, count);
+    #endif
+#endif
+            default:
+                return GetEaseFromTypeLanes<EaseLaneScalar>(easeType, start, end, alpha, out, count);
+        }
+    }
+
+    static void GetCubicBezierBatch(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+    {
+        switch (GetSimdLevel())
+        {
+#if defined(EASING_SIMD_DISPATCH_UNITS) && defined(EASING_SIMD_X86)
+            case SIMD_LEVEL_AVX512:
+                return GetCubicBezierBatchAvx512(bezier, start, end, alpha, out, count);
+
+            case SIMD_LEVEL_AVX2:
+                return GetCubicBezierBatchAvx2(bezier, start, end, alpha, out, count);
+
+            case SIMD_LEVEL_SSE2:
+                return GetCubicBezierBatchSse2(bezier, start, end, alpha, out, count);
+#elif defined(EASING_SIMD_DISPATCH_UNITS) && defined(EASING_SIMD_ARM64)
+            case SIMD_LEVEL_NEON:
+                return GetCubicBezierBatchNeon(bezier, start, end, alpha, out, count);
+#else
+    #if defined(EASING_SIMD_HAS_AVX512)
+            case SIMD_LEVEL_AVX512:
+                return GetCubicBezierLanes<EaseLaneAvx512>(bezier, start, end, alpha, out, count);
+    #endif
+    #if defined(EASING_SIMD_HAS_AVX2)
+            case SIMD_LEVEL_AVX2:
+                return GetCubicBezierLanes<EaseLaneAvx2>(bezier, start, end, alpha, out, count);
+    #endif
+    #if defined(EASING_SIMD_HAS_SSE2)
+            case SIMD_LEVEL_SSE2:
+                return GetCubicBezierLanes<EaseLaneSse2>(bezier, start, end, alpha, out, count);
+    #endif
+    #if defined(EASING_SIMD_HAS_NEON)
+            case SIMD_LEVEL_NEON:
+                return GetCubicBezierLanes<EaseLaneNeon>(bezier, start, end, alpha, out, count);
+    #endif
+#endif
+            default:
+                return GetCubicBezierLanes<EaseLaneScalar>(bezier, start, end, alpha, out, count);
+        }
+    }
+
+#if defined(EASING_SIMD_DISPATCH_UNITS)
+    //
+    // Defined by the per-ISA units in native_cpp/simd/. Every inline function a unit emits is a weak symbol compiled
+    // with its instruction set, and the linker keeps one copy of each for the whole program. So each unit instantiates
+    // only its own lane type, and the kernels call nothing but members of the lane and templates on it, whose names
+    // carry the lane type. No libm wrapper and no member of another class: std::sin or EasingCubicBezier::CurveY
+    // emitted by the AVX2 unit could be the copy the SSE2 path runs on a CPU without AVX.
+    //
+    #if defined(EASING_SIMD_X86)
+    static void GetEaseFromTypeBatchSse2(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    static void GetEaseFromTypeBatchAvx2(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    static void GetEaseFromTypeBatchAvx512(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    static void GetCubicBezierBatchSse2(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    static void GetCubicBezierBatchAvx2(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    static void GetCubicBezierBatchAvx512(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    #elif defined(EASING_SIMD_ARM64)
+    static void GetEaseFromTypeBatchNeon(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    static void GetCubicBezierBatchNeon(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count);
+    #endif
+#endif
+
+    //
+    // Evaluates the whole array with one specific lane type. The last partial group of lanes is padded, so every
+    // element goes through exactly the same kernel regardless of where it sits in the array.
+    //
+    template<typename TLane>
+    static void GetEaseFromTypeLanes(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+    {
+        switch (easeType)
+        {
+            default:
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = 0.0f;
+                }
+                return;
+
+            case EEaseType::EASE_LINEAR:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseLinear(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_SPRING:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseSpring(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_QUAD:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInQuad(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUAD:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutQuad(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutQuad(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_CUBIC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInCubic(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_CUBIC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutCubic(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutCubic(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_QUART:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInQuart(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUART:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutQuart(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUART:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutQuart(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_QUINT:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInQuint(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_QUINT:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutQuint(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutQuint(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_SINE:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInSine(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_SINE:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutSine(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutSine(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_EXPO:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInExpo(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_EXPO:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutExpo(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutExpo(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_CIRC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInCirc(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_CIRC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutCirc(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_CIRC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutCirc(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_BOUNCE:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInBounce(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_BOUNCE:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutBounce(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_BOUNCE:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutBounce(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_BACK:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInBack(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_BACK:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutBack(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_BACK:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutBack(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_ELASTIC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInElastic(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseOutElastic(s, e, a); }, start, end, alpha, out, count);
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                return EaseLanes<TLane>([](TLane s, TLane e, TLane a) { return EaseInOutElastic(s, e, a); }, start, end, alpha, out, count);
+        }
+    }
+
+    //
+    // GetCubicBezierBatch with one specific lane type. Same math as EasingCubicBezier::Sample, so results agree with it
+    // to float rounding (exactly, unless the compiler contracts multiply-adds differently in the two). It only reads the
+    // coefficients and seeds of the bezier and calls none of its members, see the dispatch units above.
+    //
+    template<typename TLane>
+    static void GetCubicBezierLanes(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+    {
+        const std::size_t BlockSize = 64;
+        static_assert(BlockSize % TLane::Width == 0, "GetCubicBezierLanes blocks must hold whole lanes");
+
+        alignas(CacheLineSize) float x[BlockSize];
+        alignas(CacheLineSize) float offset[BlockSize];
+        alignas(CacheLineSize) float knotAlpha[BlockSize];
+        alignas(CacheLineSize) float knotSlope[BlockSize];
+        alignas(CacheLineSize) float knotCurvature[BlockSize];
+        alignas(CacheLineSize) float residual[BlockSize];
+        alignas(CacheLineSize) float sample[BlockSize];
+
+        const TLane ax = TLane::Set(bezier.Ax);
+        const TLane bx = TLane::Set(bezier.Bx);
+        const TLane cx = TLane::Set(bezier.Cx);
+        const TLane ay = TLane::Set(bezier.Ay);
+        const TLane by = TLane::Set(bezier.By);
+        const TLane cy = TLane::Set(bezier.Cy);
+
+        const TLane zero = TLane::Set(0.0f);
+        const TLane one = TLane::Set(1.0f);
+        const TLane two = TLane::Set(2.0f);
+        const TLane three = TLane::Set(3.0f);
+        const TLane four = TLane::Set(4.0f);
+        const TLane half = TLane::Set(0.5f);
+        const TLane minDenominator = TLane::Set(EasingCubicBezier::MinDenominator);
+
+        for (std::size_t base = 0; base < count; base += BlockSize) {
+            const std::size_t size = count - base < BlockSize ? count - base : BlockSize;
+
+            // Gather the seeds of the nearest knot. The padding past `size` solves x = 0 and is never written out.
+            for (std::size_t j = 0; j < BlockSize; ++j) {
+                const float value = j < size ? alpha[base + j] : 0.0f;
+                const float clamped = value > 0.0f ? (value < 1.0f ? value : 1.0f) : 0.0f;
+                const std::size_t knot = std::size_t(clamped * float(EasingCubicBezier::SeedCount) + 0.5f);
+
+                x[j] = clamped;
+                offset[j] = clamped - float(knot) * (1.0f / float(EasingCubicBezier::SeedCount));
+                knotAlpha[j] = bezier.SeedAlphas[knot];
+                knotSlope[j] = bezier.SeedSlopes[knot];
+                knotCurvature[j] = bezier.SeedCurvatures[knot];
+            }
+
+            for (std::size_t j = 0; j < BlockSize; j += TLane::Width) {
+                const TLane target = TLane::Load(x + j);
+                const TLane d = TLane::Load(offset + j);
+                const TLane slope0 = TLane::Load(knotSlope + j);
+
+                // EasingCubicBezier::Seed
+                const TLane discriminant = TLane::Max(slope0 * slope0 + four * TLane::Load(knotCurvature + j) * d, zero);
+                TLane t = TLane::Load(knotAlpha + j) + two * d / TLane::Max(slope0 + TLane::Sqrt(discriminant), minDenominator);
+
+                // EasingCubicBezier::Refine
+                const TLane error = ((ax * t + bx) * t + cx) * t - target;
+                const TLane slope = (three * ax * t + two * bx) * t + cx;
+                const TLane denominator = slope * slope - half * error * (TLane::Set(6.0f) * ax * t + two * bx);
+                t = t - error * slope / TLane::Max(denominator, minDenominator);
+                t = TLane::Select(TLane::Less(zero, t), TLane::Select(TLane::Less(t, one), t, one), zero);
+
+                (((ax * t + bx) * t + cx) * t - target).Store(residual + j);
+                TLane::Select(TLane::Less(target, one), ((ay * t + by) * t + cy) * t, one).Store(sample + j);
+            }
+
+            for (std::size_t j = 0; j < size; ++j) {
+                if (!(residual[j] <= EasingCubicBezier::SolveTolerance && -residual[j] <= EasingCubicBezier::SolveTolerance)) {
+                    sample[j] = x[j] < 1.0f ? BisectCubicBezier<TLane>(bezier, x[j]) : 1.0f;
+                }
+
+                out[base + j] = start[base + j] + (end[base + j] - start[base + j]) * sample[j];
+            }
+        }
+    }
+
+private:
+    static const std::size_t CacheLineSize = 64;
+
+    static ESimdLevel DetectSimdLevel()
+    {
+#if defined(EASING_SIMD_X86) && (defined(EASING_SIMD_DISPATCH_UNITS) || defined(EASING_SIMD_HAS_SSE2))
+        bool hasAvx2 = false;
+        bool hasAvx512 = false;
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 1);
+        const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x06) == 0x06;
+        const bool osSavesZmm = osSavesYmm && (_xgetbv(0) & 0xe6) == 0xe6;
+        __cpuidex(info, 7, 0);
+        hasAvx2 = osSavesYmm && (info[1] & (1 << 5)) != 0;
+        hasAvx512 = osSavesZmm && (info[1] & (1 << 16)) != 0;
+    #else
+        hasAvx2 = __builtin_cpu_supports("avx2");
+        hasAvx512 = __builtin_cpu_supports("avx512f");
+    #endif
+
+    #if defined(EASING_SIMD_DISPATCH_UNITS) || defined(EASING_SIMD_HAS_AVX512)
+        if (hasAvx512) return SIMD_LEVEL_AVX512;
+    #endif
+    #if defined(EASING_SIMD_DISPATCH_UNITS) || defined(EASING_SIMD_HAS_AVX2)
+        if (hasAvx2) return SIMD_LEVEL_AVX2;
+    #endif
+        (void)hasAvx2;
+        (void)hasAvx512;
+        return SIMD_LEVEL_SSE2;
+#elif defined(EASING_SIMD_ARM64) && (defined(EASING_SIMD_DISPATCH_UNITS) || defined(EASING_SIMD_HAS_NEON))
+        return SIMD_LEVEL_NEON;
+#else
+        return SIMD_LEVEL_SCALAR;
+#endif
+    }
+
+    //
+    // y(t) at x(t) = x by EasingCubicBezier::Bisect, for the alphas the seeded step leaves too far off. Scalar, but
+    // templated on the lane so that each dispatch unit gets its own copy.
+    //
+    template<typename TLane>
+    static float BisectCubicBezier(const EasingCubicBezier& bezier, float x)
+    {
+        const std::size_t knot = std::size_t(x * float(EasingCubicBezier::SeedCount));
+        const std::size_t index = knot < EasingCubicBezier::SeedCount ? knot : EasingCubicBezier::SeedCount - 1;
+
+        float lo = bezier.SeedAlphas[index];
+        float hi = bezier.SeedAlphas[index + 1];
+
+        for (int iteration = 0; iteration < 32; ++iteration) {
+            const float middle = 0.5f * (lo + hi);
+
+            if (middle <= lo || middle >= hi) {
+                break;
+            }
+
+            if (((bezier.Ax * middle + bezier.Bx) * middle + bezier.Cx) * middle < x) {
+                lo = middle;
+            } else {
+                hi = middle;
+            }
+        }
+
+        const float t = 0.5f * (lo + hi);
+        return ((bezier.Ay * t + bezier.By) * t + bezier.Cy) * t;
+    }
+
+    template<typename TLane, typename TFunc>
+    static void EaseLanes(TFunc func, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+    {
+        std::size_t i = 0;
+
+        for (; i + TLane::Width <= count; i += TLane::Width) {
+            func(TLane::Load(start + i), TLane::Load(end + i), TLane::Load(alpha + i)).Store(out + i);
+        }
+
+        if (i < count) {
+            float s[TLane::Width] = {};
+            float e[TLane::Width] = {};
+            float a[TLane::Width] = {};
+            float o[TLane::Width];
+
+            for (std::size_t j = 0; i + j < count; ++j) {
+                s[j] = start[i + j];
+                e[j] = end[i + j];
+                a[j] = alpha[i + j];
+            }
+
+            func(TLane::Load(s), TLane::Load(e), TLane::Load(a)).Store(o);
+
+            for (std::size_t j = 0; i + j < count; ++j) {
+                out[i + j] = o[j];
+            }
+        }
+    }
+
+public:
+    /// Easing kernels ///
+    //
+    // Same formulas as the scalar functions in EasingFunctions, one lane at a time. `alpha / 0.5f` is written as
+    // `alpha * 2` which is exact, so the polynomial curves produce the same values as their scalar counterparts.
+    //
+
+    template<typename TLane>
+    static TLane EaseLinear(TLane start, TLane end, TLane alpha)
+    {
+        return start * (TLane::Set(1.0f) - alpha) + end * alpha;
+    }
+
+    template<typename TLane>
+    static TLane EaseSpring(TLane start, TLane end, TLane alpha)
+    {
+        alpha = TLane::Min(TLane::Max(alpha, TLane::Set(0.0f)), TLane::Set(1.0f));
+
+        const TLane one = TLane::Set(1.0f);
+        const TLane wave = Sin(alpha * TLane::Set(EasingFunctions::Pi) * (TLane::Set(0.2f) + TLane::Set(2.5f) * alpha * alpha * alpha));
+        const TLane decay = Pow(one - alpha, TLane::Set(2.2f));
+
+        alpha = (wave * decay + alpha) * (one + TLane::Set(1.2f) * (one - alpha));
+
+        return start + (end - start) * alpha;
+    }
+
+    template<typename TLane>
+    static TLane EaseInQuad(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end * alpha * alpha + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutQuad(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return -end * alpha * (alpha - TLane::Set(2.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutQuad(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha * TLane::Set(2.0f);
+        end = end - start;
+
+        const TLane half = end * TLane::Set(0.5f);
+        const TLane t = alpha - TLane::Set(1.0f);
+        const TLane in = half * alpha * alpha + start;
+        const TLane out = -half * (t * (t - TLane::Set(2.0f)) - TLane::Set(1.0f)) + start;
+
+        return TLane::Select(TLane::Less(alpha, TLane::Set(1.0f)), in, out);
+    }
+
+    template<typename TLane>
+    static TLane EaseInCubic(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end * alpha * alpha * alpha + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutCubic(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha - TLane::Set(1.0f);
+        end = end - start;
+        return end * (alpha * alpha * alpha + TLane::Set(1.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutCubic(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha * TLane::Set(2.0f);
+        end = end - start;
+
+        const TLane half = end * TLane::Set(0.5f);
+        const TLane t = alpha - TLane::Set(2.0f);
+        const TLane in = half * alpha * alpha * alpha + start;
+        const TLane out = half * (t * t * t + TLane::Set(2.0f)) + start;
+
+        return TLane::Select(TLane::Less(alpha, TLane::Set(1.0f)), in, out);
+    }
+
+    template<typename TLane>
+    static TLane EaseInQuart(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end * alpha * alpha * alpha * alpha + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutQuart(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha - TLane::Set(1.0f);
+        end = end - start;
+        return -end * (alpha * alpha * alpha * alpha - TLane::Set(1.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutQuart(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha * TLane::Set(2.0f);
+        end = end - start;
+
+        const TLane half = end * TLane::Set(0.5f);
+        const TLane t = alpha - TLane::Set(2.0f);
+        const TLane in = half * alpha * alpha * alpha * alpha + start;
+        const TLane out = -half * (t * t * t * t - TLane::Set(2.0f)) + start;
+
+        return TLane::Select(TLane::Less(alpha, TLane::Set(1.0f)), in, out);
+    }
+
+    template<typename TLane>
+    static TLane EaseInQuint(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end * alpha * alpha * alpha * alpha * alpha + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutQuint(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha - TLane::Set(1.0f);
+        end = end - start;
+        return end * (alpha * alpha * alpha * alpha * alpha + TLane::Set(1.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutQuint(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha * TLane::Set(2.0f);
+        end = end - start;
+
+        const TLane half = end * TLane::Set(0.5f);
+        const TLane t = alpha - TLane::Set(2.0f);
+        const TLane in = half * alpha * alpha * alpha * alpha * alpha + start;
+        const TLane out = half * (t * t * t * t * t + TLane::Set(2.0f)) + start;
+
+        return TLane::Select(TLane::Less(alpha, TLane::Set(1.0f)), in, out);
+    }
+
+    template<typename TLane>
+    static TLane EaseInSine(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return -end * Cos(alpha * TLane::Set(EasingFunctions::Pi * 0.5f)) + end + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutSine(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end * Sin(alpha * TLane::Set(EasingFunctions::Pi * 0.5f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutSine(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return -end * TLane::Set(0.5f) * (Cos(TLane::Set(EasingFunctions::Pi) * alpha) - TLane::Set(1.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInExpo(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end * Exp2(TLane::Set(10.0f) * (alpha - TLane::Set(1.0f))) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutExpo(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end * (-Exp2(TLane::Set(-10.0f) * alpha) + TLane::Set(1.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutExpo(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha * TLane::Set(2.0f);
+        end = end - start;
+
+        const TLane half = end * TLane::Set(0.5f);
+        const TLane in = half * Exp2(TLane::Set(10.0f) * (alpha - TLane::Set(1.0f))) + start;
+        const TLane out = half * (-Exp2(TLane::Set(-10.0f) * (alpha - TLane::Set(1.0f))) + TLane::Set(2.0f)) + start;
+
+        return TLane::Select(TLane::Less(alpha, TLane::Set(1.0f)), in, out);
+    }
+
+    template<typename TLane>
+    static TLane EaseInCirc(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return -end * (TLane::Sqrt(TLane::Set(1.0f) - alpha * alpha) - TLane::Set(1.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutCirc(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha - TLane::Set(1.0f);
+        end = end - start;
+        return end * TLane::Sqrt(TLane::Set(1.0f) - alpha * alpha) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutCirc(TLane start, TLane end, TLane alpha)
+    {
+        alpha = alpha * TLane::Set(2.0f);
+        end = end - start;
+
+        const TLane one = TLane::Set(1.0f);
+        const TLane half = end * TLane::Set(0.5f);
+        const TLane t = alpha - TLane::Set(2.0f);
+        const TLane in = -half * (TLane::Sqrt(one - alpha * alpha) - one) + start;
+        const TLane out = half * (TLane::Sqrt(one - t * t) + one) + start;
+
+        return TLane::Select(TLane::Less(alpha, one), in, out);
+    }
+
+    template<typename TLane>
+    static TLane EaseOutBounce(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+
+        // Every segment is the same parabola, only shifted. Pick the shift and the floor of the segment with masks
+        // and evaluate the parabola once.
+        TLane offset = TLane::Set(2.625f / 2.75f);
+        TLane floor = TLane::Set(0.984375f);
+
+        const typename TLane::Mask third = TLane::Less(alpha, TLane::Set(2.5f / 2.75f));
+        offset = TLane::Select(third, TLane::Set(2.25f / 2.75f), offset);
+        floor = TLane::Select(third, TLane::Set(0.9375f), floor);
+
+        const typename TLane::Mask second = TLane::Less(alpha, TLane::Set(2.0f / 2.75f));
+        offset = TLane::Select(second, TLane::Set(1.5f / 2.75f), offset);
+        floor = TLane::Select(second, TLane::Set(0.75f), floor);
+
+        const typename TLane::Mask first = TLane::Less(alpha, TLane::Set(1.0f / 2.75f));
+        offset = TLane::Select(first, TLane::Set(0.0f), offset);
+        floor = TLane::Select(first, TLane::Set(0.0f), floor);
+
+        alpha = alpha - offset;
+
+        return end * (TLane::Set(7.5625f) * alpha * alpha + floor) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInBounce(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+        return end - EaseOutBounce(TLane::Set(0.0f), end, TLane::Set(1.0f) - alpha) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutBounce(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+
+        const TLane zero = TLane::Set(0.0f);
+        const TLane half = TLane::Set(0.5f);
+        const TLane in = EaseInBounce(zero, end, alpha * TLane::Set(2.0f)) * half + start;
+        const TLane out = EaseOutBounce(zero, end, alpha * TLane::Set(2.0f) - TLane::Set(1.0f)) * half + end * half + start;
+
+        return TLane::Select(TLane::Less(alpha, half), in, out);
+    }
+
+    template<typename TLane>
+    static TLane EaseInBack(TLane start, TLane end, TLane alpha)
+    {
+        const TLane s = TLane::Set(1.70158f);
+        end = end - start;
+        return end * alpha * alpha * ((s + TLane::Set(1.0f)) * alpha - s) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseOutBack(TLane start, TLane end, TLane alpha)
+    {
+        const TLane s = TLane::Set(1.70158f);
+        end = end - start;
+        alpha = alpha - TLane::Set(1.0f);
+        return end * (alpha * alpha * ((s + TLane::Set(1.0f)) * alpha + s) + TLane::Set(1.0f)) + start;
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutBack(TLane start, TLane end, TLane alpha)
+    {
+        const TLane s = TLane::Set(1.70158f * 1.525f);
+        end = end - start;
+        alpha = alpha * TLane::Set(2.0f);
+
+        const TLane half = end * TLane::Set(0.5f);
+        const TLane t = alpha - TLane::Set(2.0f);
+        const TLane in = half * (alpha * alpha * ((s + TLane::Set(1.0f)) * alpha - s)) + start;
+        const TLane out = half * (t * t * ((s + TLane::Set(1.0f)) * t + s) + TLane::Set(2.0f)) + start;
+
+        return TLane::Select(TLane::Less(alpha, TLane::Set(1.0f)), in, out);
+    }
+
+    //
+    // The elastic curves always take the `a = end, s = p / 4` path of their scalar versions since the amplitude is
+    // fixed to zero there, so only the period is left as a constant here.
+    //
+
+    template<typename TLane>
+    static TLane EaseInElastic(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+
+        const TLane p = TLane::Set(0.3f);
+        const TLane s = p * TLane::Set(0.25f);
+        const TLane t = alpha - TLane::Set(1.0f);
+        const TLane value = -(end * Exp2(TLane::Set(10.0f) * t) * Sin((t - s) * TLane::Set(2.0f * EasingFunctions::Pi) / p)) + start;
+
+        const TLane result = TLane::Select(TLane::Equal(alpha, TLane::Set(1.0f)), start + end, value);
+        return TLane::Select(TLane::Equal(alpha, TLane::Set(0.0f)), start, result);
+    }
+
+    template<typename TLane>
+    static TLane EaseOutElastic(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+
+        const TLane p = TLane::Set(0.3f);
+        const TLane s = p * TLane::Set(0.25f);
+        const TLane value = end * Exp2(TLane::Set(-10.0f) * alpha) * Sin((alpha - s) * TLane::Set(2.0f * EasingFunctions::Pi) / p) + end + start;
+
+        const TLane result = TLane::Select(TLane::Equal(alpha, TLane::Set(1.0f)), start + end, value);
+        return TLane::Select(TLane::Equal(alpha, TLane::Set(0.0f)), start, result);
+    }
+
+    template<typename TLane>
+    static TLane EaseInOutElastic(TLane start, TLane end, TLane alpha)
+    {
+        end = end - start;
+
+        const TLane p = TLane::Set(0.3f);
+        const TLane s = p * TLane::Set(0.25f);
+        const TLane scaled = alpha * TLane::Set(2.0f);
+        const TLane t = scaled - TLane::Set(1.0f);
+        const TLane wave = Sin((t - s) * TLane::Set(2.0f * EasingFunctions::Pi) / p);
+        const TLane in = TLane::Set(-0.5f) * (end * Exp2(TLane::Set(10.0f) * t) * wave) + start;
+        const TLane out = end * Exp2(TLane::Set(-10.0f) * t) * wave * TLane::Set(0.5f) + end + start;
+
+        TLane result = TLane::Select(TLane::Less(scaled, TLane::Set(1.0f)), in, out);
+        result = TLane::Select(TLane::Equal(scaled, TLane::Set(2.0f)), start + end, result);
+        return TLane::Select(TLane::Equal(alpha, TLane::Set(0.0f)), start, result);
+    }
+
+private:
+    //
+    // EasingFunctions::FastSin/FastCos/FastExp2 in lanes, with or without EASING_FAST_MATH: a libm call would have to
+    // leave the registers one float at a time. They stay within the error bounds listed there, so the Sine, Expo and
+    // Elastic kernels are within 1.8e-7 of the libm curves over alpha in [0, 1] for start = 0, end = 1.
+    //
+
+    template<typename TLane>
+    static TLane Sin(TLane x)
+    {
+        const TLane k = TLane::Round(x * TLane::Set(0.318309886f));
+        const TLane r = ((x - k * TLane::Set(3.140625f)) - k * TLane::Set(9.67502593994140625e-4f)) - k * TLane::Set(1.509957990978376432e-7f);
+        const TLane p = SinPolynomial(r);
+        const TLane h = k * TLane::Set(0.5f);
+        return TLane::Select(TLane::Equal(h, TLane::Round(h)), p, -p);
+    }
+
+    template<typename TLane>
+    static TLane Cos(TLane x)
+    {
+        const TLane k = TLane::Round(x * TLane::Set(0.318309886f) - TLane::Set(0.5f));
+        const TLane m = k + TLane::Set(0.5f);
+        const TLane r = ((x - m * TLane::Set(3.140625f)) - m * TLane::Set(9.67502593994140625e-4f)) - m * TLane::Set(1.509957990978376432e-7f);
+        const TLane p = SinPolynomial(r);
+        const TLane h = k * TLane::Set(0.5f);
+        return TLane::Select(TLane::Equal(h, TLane::Round(h)), -p, p);
+    }
+
+    template<typename TLane>
+    static TLane Exp2(TLane x)
+    {
+        return PolynomialExp2(x);
+    }
+
+    template<typename TLane>
+    static TLane Pow(TLane base, TLane exponent)
+    {
+        // See EasingFunctions::Pow. Always polynomial, like the scalar version.
+        TLane e;
+        TLane m = TLane::SplitExponent(base, e);
+
+        const typename TLane::Mask high = TLane::Less(TLane::Set(1.41421356f), m);
+        m = TLane::Select(high, m * TLane::Set(0.5f), m);
+        e = TLane::Select(high, e + TLane::Set(1.0f), e);
+
+        const TLane s = (m - TLane::Set(1.0f)) / (m + TLane::Set(1.0f));
+        const TLane z = s * s;
+        TLane p = TLane::Set(1.0f / 9.0f);
+        p = p * z + TLane::Set(1.0f / 7.0f);
+        p = p * z + TLane::Set(1.0f / 5.0f);
+        p = p * z + TLane::Set(1.0f / 3.0f);
+        p = p * z + TLane::Set(1.0f);
+
+        const TLane log2 = e + TLane::Set(2.0f) * s * p * TLane::Set(1.44269504f);
+        const TLane result = PolynomialExp2(exponent * log2);
+
+        return TLane::Select(TLane::Less(TLane::Set(0.0f), base), result, TLane::Set(0.0f));
+    }
+
+    template<typename TLane>
+    static TLane PolynomialExp2(TLane x)
+    {
+        x = TLane::Min(TLane::Max(x, TLane::Set(-126.0f)), TLane::Set(127.0f));
+
+        const TLane n = TLane::Round(x);
+        const TLane f = x - n;
+
+        TLane p = TLane::Set(1.535336188319500e-4f);
+        p = p * f + TLane::Set(1.339887440266574e-3f);
+        p = p * f + TLane::Set(9.618437357674640e-3f);
+        p = p * f + TLane::Set(5.550332471162809e-2f);
+        p = p * f + TLane::Set(2.402264791363012e-1f);
+        p = p * f + TLane::Set(6.931472028550421e-1f);
+        p = p * f + TLane::Set(1.0f);
+
+        return p * TLane::Exp2Int(n);
+    }
+
+    template<typename TLane>
+    static TLane SinPolynomial(TLane r)
+    {
+        const TLane z = r * r;
+        TLane p = TLane::Set(-0.0000000239f);
+        p = p * z + TLane::Set(0.0000027526f);
+        p = p * z + TLane::Set(-0.0001984090f);
+        p = p * z + TLane::Set(0.0083333315f);
+        p = p * z + TLane::Set(-0.1666666664f);
+        return r * (TLane::Set(1.0f) + z * p);
+    }
+};
@@ -0,0 +1,358 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Precision policies for the curves: which type values are stored in, which type they are computed in, and the
+ * batch entry points that move between the two. Every curve in EasingFunctions.hpp computes and returns in its own T,
+ * so float, double and long double are their own compute type. EasingHalf (IEEE 754 binary16) and EasingBFloat16
+ * are storage only: they are widened to float, run through the float kernels, and rounded back, which halves the
+ * memory traffic of a large animation buffer.
+ *
+ * std::vector<EasingHalf> start, end, alpha, out;
+ *
+ * EasingPrecision<EasingHalf>::GetEaseFromTypeBatch(EasingFunctions::EASE_OUT_BOUNCE, start.data(), end.data(),
+ *     alpha.data(), out.data(), out.size());
+ *
+ * EasingHalf value = EasingPrecision<EasingHalf>::GetEaseFromType(EasingFunctions::EASE_IN_SINE, start[0], end[0], alpha[0]);
+ * double exact = EasingPrecision<double>::GetEaseFromType(EasingFunctions::EASE_IN_SINE, 0.0, 1.0, 0.3);
+ *
+ * Packed batches convert BlockSize elements at a time into float arrays on the stack and hand them to
+ * EasingFunctionsSimd (values) or EasingFunctions (derivatives), so out may alias any of the inputs. The result is
+ * the float result rounded once to the storage type, to nearest even. Half keeps 11 significant bits up to 65504,
+ * bfloat16 keeps 8 bits over the whole float range; alpha is rounded the same way on the way in, which on a steep
+ * curve costs more than the rounding of the result.
+ *
+ * Half conversion uses F16C when the translation unit is compiled with it (-mf16c, or -march for a CPU that has
+ * it), and exact integer code otherwise. Both give the same bits for everything but the payload of a NaN.
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+#include "EasingFunctionsSimd.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__F16C__)
+    #include <immintrin.h>
+#endif
+
+//
+// 16 bit storage formats. The raw bits are public so buffers can be filled straight from files or GPU readbacks.
+//
+struct EasingHalf
+{
+    std::uint16_t Bits;
+
+    static EasingHalf FromBits(std::uint16_t bits)
+    {
+        return EasingHalf{ bits };
+    }
+
+    //
+    // Round to nearest even. Overflow gives infinity, values below 2^-24 flush to a signed zero through the
+    // subnormals, and NaN stays a quiet NaN. Every case is computed and the right one selected.
+    //
+    static EasingHalf FromFloat(float value)
+    {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        const std::uint32_t sign = (bits >> 16) & 0x8000u;
+        bits &= 0x7fffffffu;
+
+        // Rebias the exponent, then round the 13 dropped bits to nearest even. A carry out of the mantissa moves into
+        // the exponent, up to infinity, which is what rounding there should do.
+        const std::uint32_t normal = (bits + 0xc8000fffu + ((bits >> 13) & 1u)) >> 13;
+
+        // Below the smallest normal half, adding 0.5 lines the subnormal bits up with the bottom of the mantissa and
+        // lets the FPU do the rounding.
+        float magnitude = 0.0f;
+        std::uint32_t subnormal = 0;
+        std::memcpy(&magnitude, &bits, sizeof(magnitude));
+        magnitude += 0.5f;
+        std::memcpy(&subnormal, &magnitude, sizeof(subnormal));
+        subnormal -= 0x3f000000u;
+
+        // 65536 and up, infinity and NaN. The compares are signed, which SSE2 has, and bits is below 2^31.
+        const std::int32_t magnitudeBits = std::int32_t(bits);
+        const std::uint32_t overflow = 0x7c00u | (Mask(magnitudeBits > 0x7f800000) & 0x0200u);
+
+        std::uint32_t half = Select(Mask(magnitudeBits < 0x38800000), subnormal, normal);
+        half = Select(Mask(magnitudeBits >= 0x47800000), overflow, half);
+
+        return EasingHalf{ std::uint16_t(half | sign) };
+    }
+
+    float ToFloat() const
+    {
+        const std::uint32_t shifted = std::uint32_t(Bits & 0x7fffu) << 13;
+        const std::uint32_t exponent = shifted & 0x0f800000u;
+        const std::uint32_t normal = shifted + 0x38000000u;
+
+        // Infinity and NaN keep an all ones exponent.
+        const std::uint32_t infinite = normal + 0x38000000u;
+
+        // Subnormal: give it the smallest normal exponent and subtract that implicit 1 back off.
+        const std::uint32_t smallestNormalBits = 0x38800000u;
+        const std::uint32_t scaledBits = normal + 0x00800000u;
+        float smallestNormal = 0.0f;
+        float scaled = 0.0f;
+        std::uint32_t subnormal = 0;
+        std::memcpy(&smallestNormal, &smallestNormalBits, sizeof(smallestNormal));
+        std::memcpy(&scaled, &scaledBits, sizeof(scaled));
+        scaled -= smallestNormal;
+        std::memcpy(&subnormal, &scaled, sizeof(subnormal));
+
+        std::uint32_t bits = Select(Mask(exponent == 0x0f800000u), infinite, Select(Mask(exponent == 0), subnormal, normal));
+        bits |= std::uint32_t(Bits & 0x8000u) << 16;
+
+        float value = 0.0f;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+private:
+    //
+    // All ones or all zeros, and a select through it. GCC does not if-convert the ternaries here, and these keep the
+    // array conversions free of branches so they vectorize.
+    //
+    static std::uint32_t Mask(bool condition)
+    {
+        return 0u - std::uint32_t(condition);
+    }
+
+    static std::uint32_t Select(std::uint32_t mask, std::uint32_t a, std::uint32_t b)
+    {
+        return (a & mask) | (b & ~mask);
+    }
+};
+
+struct EasingBFloat16
+{
+    std::uint16_t Bits;
+
+    static EasingBFloat16 FromBits(std::uint16_t bits)
+    {
+        return EasingBFloat16{ bits };
+    }
+
+    //
+    // The top half of a float, rounded to nearest even. NaN stays a quiet NaN rather than rounding into infinity.
+    //
+    static EasingBFloat16 FromFloat(float value)
+    {
+        std::uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        const std::uint32_t rounded = (bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16;
+        const std::uint32_t quiet = (bits >> 16) | 0x0040u;
+
+        return EasingBFloat16{ std::uint16_t(std::int32_t(bits & 0x7fffffffu) > 0x7f800000 ? quiet : rounded) };
+    }
+
+    float ToFloat() const
+    {
+        const std::uint32_t bits = std::uint32_t(Bits) << 16;
+        float value = 0.0f;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+};
+
+//
+// Maps a storage type to the type its curves are computed in. float, double and long double compute in themselves;
+// specialize it, with Widen and Narrow over arrays, to add another storage format.
+//
+template<typename TStorage>
+struct EasingStorageTraits
+{
+    typedef TStorage Compute;
+
+    static void Widen(const TStorage* src, Compute* dst, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = src[i];
+        }
+    }
+
+    static void Narrow(const Compute* src, TStorage* dst, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = src[i];
+        }
+    }
+};
+
+template<>
+struct EasingStorageTraits<EasingHalf>
+{
+    typedef float Compute;
+
+    static void Widen(const EasingHalf* src, float* dst, std::size_t count)
+    {
+        std::size_t i = 0;
+
+#if defined(__F16C__)
+        for (; i + 8 <= count; i += 8) {
+            const __m128i bits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(bits));
+        }
+#endif
+
+        for (; i < count; ++i) {
+            dst[i] = src[i].ToFloat();
+        }
+    }
+
+    static void Narrow(const float* src, EasingHalf* dst, std::size_t count)
+    {
+        std::size_t i = 0;
+
+#if defined(__F16C__)
+        for (; i + 8 <= count; i += 8) {
+            const __m128i bits = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bits);
+        }
+#endif
+
+        for (; i < count; ++i) {
+            dst[i] = EasingHalf::FromFloat(src[i]);
+        }
+    }
+};
+
+template<>
+struct EasingStorageTraits<EasingBFloat16>
+{
+    typedef float Compute;
+
+    static void Widen(const EasingBFloat16* src, float* dst, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = src[i].ToFloat();
+        }
+    }
+
+    static void Narrow(const float* src, EasingBFloat16* dst, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            dst[i] = EasingBFloat16::FromFloat(src[i]);
+        }
+    }
+};
+
+template<typename TStorage>
+class EasingPrecision
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+    typedef TStorage Storage;
+    typedef typename EasingStorageTraits<TStorage>::Compute Compute;
+
+    static const std::size_t CacheLineSize = 64;
+
+    //
+    // Elements converted per pass of a packed batch: three inputs and one output of float, 4 KB on the stack.
+    //
+    static const std::size_t BlockSize = 256;
+
+    static Storage GetEaseFromType(EEaseType easeType, Storage start, Storage end, Storage alpha)
+    {
+        return Narrow(EasingFunctions::GetEaseFromType(easeType, Widen(start), Widen(end), Widen(alpha)));
+    }
+
+    static Storage GetEaseDerivativeFromType(EEaseType easeType, Storage start, Storage end, Storage alpha)
+    {
+        return Narrow(EasingFunctions::GetEaseDerivativeFromType(easeType, Widen(start), Widen(end), Widen(alpha)));
+    }
+
+    //
+    // start, end, alpha and out must each point to at least `count` elements. out may alias any of the inputs.
+    //
+    static void GetEaseFromTypeBatch(EEaseType easeType, const Storage* start, const Storage* end, const Storage* alpha,
+        Storage* out, std::size_t count)
+    {
+        Batch<false>(easeType, start, end, alpha, out, count, std::is_same<Storage, Compute>());
+    }
+
+    static void GetEaseDerivativeFromTypeBatch(EEaseType easeType, const Storage* start, const Storage* end, const Storage* alpha,
+        Storage* out, std::size_t count)
+    {
+        Batch<true>(easeType, start, end, alpha, out, count, std::is_same<Storage, Compute>());
+    }
+
+    static Compute Widen(Storage value)
+    {
+        Compute result;
+        EasingStorageTraits<Storage>::Widen(&value, &result, 1);
+        return result;
+    }
+
+    static Storage Narrow(Compute value)
+    {
+        Storage result;
+        EasingStorageTraits<Storage>::Narrow(&value, &result, 1);
+        return result;
+    }
+
+private:
+    //
+    // Float batches of values take the SIMD kernels; everything else goes through the scalar batches.
+    //
+    template<bool IsDerivative>
+    static void ComputeBatch(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+    {
+        if (IsDerivative) {
+            EasingFunctions::GetEaseDerivativeFromTypeBatch(easeType, start, end, alpha, out, count);
+        } else {
+            EasingFunctionsSimd::GetEaseFromTypeBatch(easeType, start, end, alpha, out, count);
+        }
+    }
+
+    template<bool IsDerivative, typename T>
+    static void ComputeBatch(EEaseType easeType, const T* start, const T* end, const T* alpha, T* out, std::size_t count)
+    {
+        if (IsDerivative) {
+            EasingFunctions::GetEaseDerivativeFromTypeBatch(easeType, start, end, alpha, out, count);
+        } else {
+            EasingFunctions::GetEaseFromTypeBatch(easeType, start, end, alpha, out, count);
+        }
+    }
+
+    template<bool IsDerivative>
+    static void Batch(EEaseType easeType, const Storage* start, const Storage* end, const Storage* alpha, Storage* out,
+        std::size_t count, std::true_type)
+    {
+        ComputeBatch<IsDerivative>(easeType, start, end, alpha, out, count);
+    }
+
+    template<bool IsDerivative>
+    static void Batch(EEaseType easeType, const Storage* start, const Storage* end, const Storage* alpha, Storage* out,
+        std::size_t count, std::false_type)
+    {
+        alignas(CacheLineSize) Compute wideStart[BlockSize];
+        alignas(CacheLineSize) Compute wideEnd[BlockSize];
+        alignas(CacheLineSize) Compute wideAlpha[BlockSize];
+        alignas(CacheLineSize) Compute wideOut[BlockSize];
+
+        for (std::size_t offset = 0; offset < count; offset += BlockSize) {
+            const std::size_t size = count - offset < BlockSize ? count - offset : BlockSize;
+
+            EasingStorageTraits<Storage>::Widen(start + offset, wideStart, size);
+            EasingStorageTraits<Storage>::Widen(end + offset, wideEnd, size);
+            EasingStorageTraits<Storage>::Widen(alpha + offset, wideAlpha, size);
+
+            ComputeBatch<IsDerivative>(easeType, wideStart, wideEnd, wideAlpha, wideOut, size);
+
+            EasingStorageTraits<Storage>::Narrow(wideOut, out + offset, size);
+        }
+    }
+};
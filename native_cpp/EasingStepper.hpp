@@ -0,0 +1,578 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Incremental evaluation of a tween that always advances by the same time step, as on a fixed tick server. Instead of
+ * computing the curve from alpha every tick, a stepper carries the curve forward from one tick to the next.
+ *
+ * EasingPolynomialStepper stepper(EasingFunctions::EASE_IN_OUT_CUBIC, 0.0f, 10.0f, 2.0f, 1.0f / 60.0f);
+ *
+ * float value = stepper.GetValue();       // alpha 0, the start value
+ *
+ * while (!stepper.IsFinished()) {
+ *     value = stepper.Next();             // one tick later
+ * }
+ *
+ * EasingPolynomialStepper steps the polynomial curves (Linear and Quad to Quint, In, Out and InOut) with forward
+ * differences: a curve of degree d sampled at evenly spaced alphas has a constant d-th difference, so keeping the value
+ * and its d differences and adding each difference into the one above it gives the next sample in d additions and no
+ * multiplications.
+ *
+ * EasingRecurrenceStepper steps the Sine, Expo and Elastic curves, In, Out and InOut. Each of them is, on each half,
+ * offset + amplitude * 2^(g * alpha) * cos(w * alpha + phase): the real part of a complex number that is scaled by
+ * 2^(g * dt) and rotated by w * dt from one tick to the next. One complex multiplication a tick replaces the calls to
+ * exp2, sin and cos. EasingWave holds those parameters for each curve, for code that steps the curves its own way.
+ *
+ * Both are computed exactly at the tick they start from, so they only drift by the rounding of their own arithmetic.
+ * They re-seed every ResyncInterval ticks to keep that bounded however long the tween runs, and at the first tick past
+ * alpha 0.5 of an InOut curve made of two halves. The running values are doubles: with those, the drift stays below
+ * float precision, and a tick stays a handful of additions and multiplications.
+ *
+ * Alpha at tick n is n * deltaTime / duration, computed from n rather than accumulated, so a stepper finishes on
+ * exactly the tick where that reaches 1 and then holds the value at alpha 1. Curves a stepper does not cover are
+ * accepted and evaluated from alpha every tick through GetEaseFromType, so code stepping a mix of tweens does not need
+ * to sort them out first.
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+//
+// The tick count and the seeding schedule shared by the steppers. Not used on its own.
+//
+class EasingStepperClock
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    //
+    // Ticks between re-seeds, about 17 seconds at 60 ticks a second. Seeded exactly, the steppers stay within float
+    // rounding of the curve for millions of ticks, so this is a bound on the drift rather than a correction of it, and
+    // costs a few nanoseconds spread over the whole interval.
+    //
+    static const std::uint64_t ResyncInterval = 1024;
+
+    float GetAlpha() const { return Step >= EndStep ? 1.0f : float(AlphaAt(Step)); }
+    std::uint64_t GetStep() const { return Step; }
+    EEaseType GetEaseType() const { return EaseType; }
+    bool IsFinished() const { return Step >= EndStep; }
+
+protected:
+    static const std::uint64_t Never = ~std::uint64_t(0);
+
+    //
+    // A zero length tween is finished at once, like in EasingTweenPool; with a deltaTime of 0 or less the stepper never
+    // gets past its start value. `halves` is true for curves that switch formula at alpha 0.5.
+    //
+    void ResetClock(EEaseType easeType, float start, float end, float duration, float deltaTime, bool halves)
+    {
+        EaseType = easeType;
+        Start = start;
+        End = end;
+        Rate = duration > 0.0f ? double(deltaTime) / double(duration) : 0.0;
+        Step = 0;
+        EndStep = duration > 0.0f ? FirstStepAt(1.0) : 0;
+        MiddleStep = halves ? FirstStepAt(0.5) : Never;
+    }
+
+    double AlphaAt(std::uint64_t step) const
+    {
+        return double(step) * Rate;
+    }
+
+    bool IsSecondHalf() const
+    {
+        return Step >= MiddleStep;
+    }
+
+    //
+    // The curve at the current tick, from alpha.
+    //
+    double ExactValue() const
+    {
+        return EasingFunctions::GetEaseFromType(EaseType, double(Start), double(End), Step >= EndStep ? 1.0 : AlphaAt(Step));
+    }
+
+    //
+    // Called after seeding at the current tick: the next seed is ResyncInterval ticks on, or at the middle switch or
+    // the end if either comes first. A finished stepper keeps NextSeedStep at its last tick, and one that is not
+    // stepping a curve seeds on every tick.
+    //
+    void ScheduleNextSeed(bool incremental)
+    {
+        if (Step >= EndStep) {
+            NextSeedStep = Step;
+            return;
+        }
+
+        const std::uint64_t limit = IsSecondHalf() || EndStep < MiddleStep ? EndStep : MiddleStep;
+        const std::uint64_t interval = incremental ? ResyncInterval : 1;
+
+        NextSeedStep = Step + interval < limit ? Step + interval : limit;
+    }
+
+    EEaseType EaseType;
+    float Start;
+    float End;
+    double Rate;
+
+    std::uint64_t Step;
+    std::uint64_t EndStep;
+    std::uint64_t MiddleStep;
+    std::uint64_t NextSeedStep;
+
+private:
+    //
+    // The first tick whose alpha reaches `alpha`, with the same rounding as AlphaAt.
+    //
+    std::uint64_t FirstStepAt(double alpha) const
+    {
+        const double estimate = Rate > 0.0 ? std::ceil(alpha / Rate) : 0.0;
+
+        // Beyond 2^53 ticks the step count is no longer exact in a double, and no tween runs that long anyway.
+        if (!(Rate > 0.0) || !(estimate < 9007199254740992.0)) {
+            return Never;
+        }
+
+        std::uint64_t step = std::uint64_t(estimate);
+
+        while (step > 0 && AlphaAt(step - 1) >= alpha) {
+            --step;
+        }
+
+        while (AlphaAt(step) < alpha) {
+            ++step;
+        }
+
+        return step;
+    }
+};
+
+class EasingPolynomialStepper : public EasingStepperClock
+{
+public:
+    EasingPolynomialStepper()
+    {
+        Reset(EasingFunctions::EASE_LINEAR, 0.0f, 0.0f, 0.0f, 0.0f);
+    }
+
+    EasingPolynomialStepper(EEaseType easeType, float start, float end, float duration, float deltaTime)
+    {
+        Reset(easeType, start, end, duration, deltaTime);
+    }
+
+    //
+    // Rewinds to alpha 0 for a new tween.
+    //
+    void Reset(EEaseType easeType, float start, float end, float duration, float deltaTime)
+    {
+        Degree = GetDegree(easeType);
+        Shape = GetShape(easeType);
+        ResetClock(easeType, start, end, duration, deltaTime, Shape == SHAPE_IN_OUT);
+
+        Seed();
+    }
+
+    //
+    // Advances one tick and returns the value there.
+    //
+    float Next()
+    {
+        // One branch on the common path.
+        if (Step + 1 >= NextSeedStep) {
+            if (Step < EndStep) {
+                ++Step;
+                Seed();
+            }
+
+            return float(Differences[0]);
+        }
+
+        ++Step;
+
+        // Unused differences are 0, so the degree does not need a branch. Each one is added before it is updated.
+        Differences[0] += Differences[1];
+        Differences[1] += Differences[2];
+        Differences[2] += Differences[3];
+        Differences[3] += Differences[4];
+        Differences[4] += Differences[5];
+
+        return float(Differences[0]);
+    }
+
+    float GetValue() const { return float(Differences[0]); }
+
+    //
+    // False for the curves that are evaluated from alpha every tick rather than stepped.
+    //
+    bool IsIncremental() const { return Degree > 0; }
+
+private:
+    enum EShape
+    {
+        SHAPE_IN,
+        SHAPE_OUT,
+        SHAPE_IN_OUT
+    };
+
+    static const int MaxDegree = 5;
+
+    static int GetDegree(EEaseType easeType)
+    {
+        switch (easeType)
+        {
+            default:
+                return 0;
+
+            case EEaseType::EASE_LINEAR:
+                return 1;
+
+            case EEaseType::EASE_IN_QUAD:
+            case EEaseType::EASE_OUT_QUAD:
+            case EEaseType::EASE_IN_OUT_QUAD:
+                return 2;
+
+            case EEaseType::EASE_IN_CUBIC:
+            case EEaseType::EASE_OUT_CUBIC:
+            case EEaseType::EASE_IN_OUT_CUBIC:
+                return 3;
+
+            case EEaseType::EASE_IN_QUART:
+            case EEaseType::EASE_OUT_QUART:
+            case EEaseType::EASE_IN_OUT_QUART:
+                return 4;
+
+            case EEaseType::EASE_IN_QUINT:
+            case EEaseType::EASE_OUT_QUINT:
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return 5;
+        }
+    }
+
+    static EShape GetShape(EEaseType easeType)
+    {
+        switch (easeType)
+        {
+            default:
+                return SHAPE_IN;
+
+            case EEaseType::EASE_OUT_QUAD:
+            case EEaseType::EASE_OUT_CUBIC:
+            case EEaseType::EASE_OUT_QUART:
+            case EEaseType::EASE_OUT_QUINT:
+                return SHAPE_OUT;
+
+            case EEaseType::EASE_IN_OUT_QUAD:
+            case EEaseType::EASE_IN_OUT_CUBIC:
+            case EEaseType::EASE_IN_OUT_QUART:
+            case EEaseType::EASE_IN_OUT_QUINT:
+                return SHAPE_IN_OUT;
+        }
+    }
+
+    //
+    // Each half of a curve is offset + scale * (slope * alpha + intercept)^degree on the normalized curve, matching the
+    // formulas in EasingFunctions.hpp.
+    //
+    struct Segment
+    {
+        double Offset;
+        double Scale;
+        double Slope;
+        double Intercept;
+    };
+
+    static Segment GetSegment(EShape shape, bool secondHalf)
+    {
+        switch (shape)
+        {
+            default:
+                return { 0.0, 1.0, 1.0, 0.0 };
+
+            case SHAPE_OUT:
+                return { 1.0, -1.0, -1.0, 1.0 };
+
+            case SHAPE_IN_OUT:
+                return secondHalf ? Segment{ 1.0, -0.5, -2.0, 2.0 } : Segment{ 0.0, 0.5, 2.0, 0.0 };
+        }
+    }
+
+    //
+    // Restarts the differences from the exact curve at the current tick.
+    //
+    // Differencing d + 1 sampled values would cancel almost every digit: the d-th difference of a Quint at 60 ticks a
+    // second over ten seconds is around 1e-17 of the value. Instead the curve is expanded around this tick, as
+    // sum of a[m] * t^m in ticks t from now, and the forward differences of t^m at 0 are exact integers: the k-th one
+    // is k! S(m, k), the number of ways to map m things onto k (S being the Stirling numbers of the second kind). Every
+    // term of a difference then has the same sign as its leading one, and keeps full relative precision.
+    //
+    void Seed()
+    {
+        static const double Surjections[MaxDegree + 1][MaxDegree + 1] =
+        {
+            { 1.0, 0.0, 0.0, 0.0, 0.0, 0.0 },
+            { 0.0, 1.0, 0.0, 0.0, 0.0, 0.0 },
+            { 0.0, 1.0, 2.0, 0.0, 0.0, 0.0 },
+            { 0.0, 1.0, 6.0, 6.0, 0.0, 0.0 },
+            { 0.0, 1.0, 14.0, 36.0, 24.0, 0.0 },
+            { 0.0, 1.0, 30.0, 150.0, 240.0, 120.0 }
+        };
+
+        for (int i = 0; i <= MaxDegree; ++i) {
+            Differences[i] = 0.0;
+        }
+
+        ScheduleNextSeed(IsIncremental());
+
+        if (Degree == 0 || Step >= EndStep) {
+            Differences[0] = ExactValue();
+            return;
+        }
+
+        const Segment segment = GetSegment(Shape, IsSecondHalf());
+        const double range = double(End) - double(Start);
+
+        // (u + h * t)^d, with u the base at this tick and h its change per tick.
+        const double u = segment.Slope * AlphaAt(Step) + segment.Intercept;
+        const double h = segment.Slope * Rate;
+
+        double powers[MaxDegree + 1];
+        powers[0] = 1.0;
+
+        for (int i = 1; i <= Degree; ++i) {
+            powers[i] = powers[i - 1] * u;
+        }
+
+        // a[m] = range * scale * C(d, m) * u^(d - m) * h^m.
+        double coefficient = range * segment.Scale;
+
+        for (int m = 0; m <= Degree; ++m) {
+            const double a = coefficient * powers[Degree - m];
+
+            for (int k = 0; k <= m; ++k) {
+                Differences[k] += a * Surjections[m][k];
+            }
+
+            coefficient *= h * double(Degree - m) / double(m + 1);
+        }
+
+        Differences[0] += double(Start) + range * segment.Offset;
+    }
+
+    int Degree;
+    EShape Shape;
+
+    double Differences[MaxDegree + 1];
+};
+
+//
+// One half of a Sine, Expo or Elastic curve on the normalized curve: offset + amplitude * 2^(exponent * alpha) *
+// cos(frequency * alpha + phase), matching the formulas in EasingFunctions.hpp. The cosine term is the real part of
+// amplitude * 2^(exponent * alpha) * e^(i * (frequency * alpha + phase)), which moving alpha on by a fixed step scales
+// and rotates by the same complex factor every time.
+//
+struct EasingWave
+{
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    double Offset;
+    double Amplitude;
+    double Exponent;
+    double Frequency;
+    double Phase;
+
+    //
+    // The complex term at alpha, on a curve from 0 to `range`.
+    //
+    void Evaluate(double range, double alpha, double& real, double& imaginary) const
+    {
+        const double magnitude = range * Amplitude * std::exp2(Exponent * alpha);
+        const double angle = Frequency * alpha + Phase;
+
+        real = magnitude * std::cos(angle);
+        imaginary = magnitude * std::sin(angle);
+    }
+
+    //
+    // The factor that moves the complex term on by `step` in alpha.
+    //
+    void Rotation(double step, double& real, double& imaginary) const
+    {
+        const double growth = std::exp2(Exponent * step);
+
+        real = growth * std::cos(Frequency * step);
+        imaginary = growth * std::sin(Frequency * step);
+    }
+
+    //
+    // True for the curves whose second half is a different wave from the first.
+    //
+    static bool HasHalves(EEaseType easeType)
+    {
+        return easeType == EEaseType::EASE_IN_OUT_EXPO || easeType == EEaseType::EASE_IN_OUT_ELASTIC;
+    }
+
+    //
+    // Returns false, and a flat wave, for the curves that are not of this form.
+    //
+    static bool FromType(EEaseType easeType, bool secondHalf, EasingWave& wave)
+    {
+        const double pi = EasingFunctions::PiAs<double>();
+
+        // The Elastic period and its quarter period shift, sin(x) written as cos(x - pi / 2).
+        const double period = 0.3;
+        const double frequency = 2.0 * pi / period;
+        const double inPhase = -frequency * (1.0 + period * 0.25) - pi * 0.5;
+        const double outPhase = -frequency * period * 0.25 - pi * 0.5;
+
+        switch (easeType)
+        {
+            default:
+                wave = { 0.0, 0.0, 0.0, 0.0, 0.0 };
+                return false;
+
+            case EEaseType::EASE_IN_SINE:
+                wave = { 1.0, -1.0, 0.0, pi * 0.5, 0.0 };
+                return true;
+
+            case EEaseType::EASE_OUT_SINE:
+                wave = { 0.0, 1.0, 0.0, pi * 0.5, -pi * 0.5 };
+                return true;
+
+            case EEaseType::EASE_IN_OUT_SINE:
+                wave = { 0.5, -0.5, 0.0, pi, 0.0 };
+                return true;
+
+            case EEaseType::EASE_IN_EXPO:
+                wave = { 0.0, 1.0 / 1024.0, 10.0, 0.0, 0.0 };
+                return true;
+
+            case EEaseType::EASE_OUT_EXPO:
+                wave = { 1.0, -1.0, -10.0, 0.0, 0.0 };
+                return true;
+
+            case EEaseType::EASE_IN_OUT_EXPO:
+                wave = secondHalf ? EasingWave{ 1.0, -512.0, -20.0, 0.0, 0.0 } : EasingWave{ 0.0, 1.0 / 2048.0, 20.0, 0.0, 0.0 };
+                return true;
+
+            case EEaseType::EASE_IN_ELASTIC:
+                wave = { 0.0, -1.0 / 1024.0, 10.0, frequency, inPhase };
+                return true;
+
+            case EEaseType::EASE_OUT_ELASTIC:
+                wave = { 1.0, 1.0, -10.0, frequency, outPhase };
+                return true;
+
+            case EEaseType::EASE_IN_OUT_ELASTIC:
+                wave = secondHalf
+                    ? EasingWave{ 1.0, 512.0, -20.0, 2.0 * frequency, inPhase }
+                    : EasingWave{ 0.0, -1.0 / 2048.0, 20.0, 2.0 * frequency, inPhase };
+                return true;
+        }
+    }
+};
+
+class EasingRecurrenceStepper : public EasingStepperClock
+{
+public:
+    EasingRecurrenceStepper()
+    {
+        Reset(EasingFunctions::EASE_LINEAR, 0.0f, 0.0f, 0.0f, 0.0f);
+    }
+
+    EasingRecurrenceStepper(EEaseType easeType, float start, float end, float duration, float deltaTime)
+    {
+        Reset(easeType, start, end, duration, deltaTime);
+    }
+
+    //
+    // Rewinds to alpha 0 for a new tween.
+    //
+    void Reset(EEaseType easeType, float start, float end, float duration, float deltaTime)
+    {
+        Incremental = EasingWave::FromType(easeType, false, Waves[0]);
+        EasingWave::FromType(easeType, true, Waves[1]);
+        ResetClock(easeType, start, end, duration, deltaTime, EasingWave::HasHalves(easeType));
+
+        // Seed only sets up the recurrence for the curves it steps. Zero it so the others leave nothing indeterminate.
+        Base = 0.0;
+        Real = 0.0;
+        Imaginary = 0.0;
+        RotationReal = 0.0;
+        RotationImaginary = 0.0;
+
+        Seed();
+    }
+
+    //
+    // Advances one tick and returns the value there.
+    //
+    float Next()
+    {
+        // One branch on the common path.
+        if (Step + 1 >= NextSeedStep) {
+            if (Step < EndStep) {
+                ++Step;
+                Seed();
+            }
+
+            return Value;
+        }
+
+        ++Step;
+
+        const double real = Real * RotationReal - Imaginary * RotationImaginary;
+        Imaginary = Real * RotationImaginary + Imaginary * RotationReal;
+        Real = real;
+
+        Value = float(Base + Real);
+        return Value;
+    }
+
+    float GetValue() const { return Value; }
+
+    //
+    // False for the curves that are evaluated from alpha every tick rather than stepped.
+    //
+    bool IsIncremental() const { return Incremental; }
+
+private:
+    //
+    // Restarts the recurrence from the exact curve at the current tick. The value at a seed comes from
+    // GetEaseFromType, which also covers alpha 0 and 1 of the Elastic curves, where the formulas are overridden.
+    //
+    void Seed()
+    {
+        ScheduleNextSeed(Incremental);
+        Value = float(ExactValue());
+
+        if (!Incremental || Step >= EndStep) {
+            return;
+        }
+
+        const EasingWave& wave = Waves[IsSecondHalf() ? 1 : 0];
+        const double range = double(End) - double(Start);
+
+        Base = double(Start) + range * wave.Offset;
+        wave.Evaluate(range, AlphaAt(Step), Real, Imaginary);
+        wave.Rotation(Rate, RotationReal, RotationImaginary);
+    }
+
+    bool Incremental;
+    EasingWave Waves[2];
+
+    float Value;
+    double Base;
+    double Real;
+    double Imaginary;
+    double RotationReal;
+    double RotationImaginary;
+};
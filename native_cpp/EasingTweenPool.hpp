@@ -0,0 +1,419 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * A container for large numbers of float tweens. Tweens are bucketed by curve, and each bucket keeps its fields in
+ * separate cache line aligned arrays (structure of arrays). Update advances a whole bucket in one homogeneous pass and
+ * evaluates it with EasingFunctionsSimd::GetEaseFromTypeBatch, instead of one GetEaseFromType call per tween.
+ *
+ * EasingTweenPool pool;
+ * EasingTweenPool::TweenId id = pool.Add(EasingFunctions::EASE_OUT_BOUNCE, 0.0f, 10.0f, 0.5f);
+ *
+ * pool.Update(deltaTime);
+ * float value = pool.GetValue(id);
+ *
+ * for (std::size_t i = 0; i < pool.GetCompletedCount(); ++i) { ... pool.GetCompleted()[i] ... }
+ * pool.RemoveCompleted();
+ *
+ * Ids stay valid until the tween is removed and are then reused. Removal is swap-and-pop, so bucket order is not
+ * stable. A tween is reported in the completed list once, by the Update that takes it to its duration, or by the
+ * first Update after Add for one that is added already finished (zero duration, or elapsed past it). Finished
+ * tweens stay in the pool, holding their end value, until they are removed. Memory only grows when the pool grows
+ * past its previous size, so steady state Add/Remove/Update cycles do not allocate.
+ *
+ * Update(deltaTime, workers) does the same work on an EasingWorkerPool and gives bit-identical results.
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+#include "EasingFunctionsSimd.hpp"
+#include "EasingWorkerPool.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+template<typename T, std::size_t Alignment>
+class EasingAlignedAllocator
+{
+public:
+    typedef T value_type;
+
+    template<typename U>
+    struct rebind
+    {
+        typedef EasingAlignedAllocator<U, Alignment> other;
+    };
+
+    EasingAlignedAllocator() = default;
+
+    template<typename U>
+    EasingAlignedAllocator(const EasingAlignedAllocator<U, Alignment>&)
+    {
+    }
+
+    T* allocate(std::size_t count)
+    {
+        // Over-allocate, round up to the alignment and keep the original pointer just in front of the block.
+        void* raw = ::operator new(count * sizeof(T) + Alignment + sizeof(void*));
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*);
+        void* aligned = reinterpret_cast<void*>((address + Alignment - 1) & ~std::uintptr_t(Alignment - 1));
+
+        static_cast<void**>(aligned)[-1] = raw;
+        return static_cast<T*>(aligned);
+    }
+
+    void deallocate(T* pointer, std::size_t)
+    {
+        ::operator delete(reinterpret_cast<void**>(pointer)[-1]);
+    }
+
+    template<typename U>
+    bool operator==(const EasingAlignedAllocator<U, Alignment>&) const { return true; }
+
+    template<typename U>
+    bool operator!=(const EasingAlignedAllocator<U, Alignment>&) const { return false; }
+};
+
+class EasingTweenPool
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+    typedef std::uint32_t TweenId;
+
+    static const std::size_t CacheLineSize = 64;
+    static const TweenId InvalidTweenId = ~TweenId(0);
+
+    template<typename T>
+    using AlignedArray = std::vector<T, EasingAlignedAllocator<T, CacheLineSize>>;
+
+    //
+    // Reserves room for `count` tweens of one curve, so adding up to that many does not allocate.
+    //
+    void Reserve(EEaseType easeType, std::size_t count)
+    {
+        Bucket& bucket = Buckets[easeType];
+
+        bucket.Start.reserve(count);
+        bucket.End.reserve(count);
+        bucket.Duration.reserve(count);
+        bucket.Elapsed.reserve(count);
+        bucket.Alpha.reserve(count);
+        bucket.Value.reserve(count);
+        bucket.Reported.reserve(count);
+        bucket.Ids.reserve(count);
+    }
+
+    TweenId Add(EEaseType easeType, float start, float end, float duration, float elapsed = 0.0f)
+    {
+        if (easeType >= EasingFunctions::EASE_TYPE_COUNT) {
+            return InvalidTweenId;
+        }
+
+        TweenId id = InvalidTweenId;
+
+        if (FreeIds.empty()) {
+            id = TweenId(Locations.size());
+            Locations.push_back(Location());
+            Completed.resize(Locations.size());
+        } else {
+            id = FreeIds.back();
+            FreeIds.pop_back();
+        }
+
+        Bucket& bucket = Buckets[easeType];
+        const float alpha = AlphaFromElapsed(elapsed, duration);
+
+        Locations[id].EaseType = easeType;
+        Locations[id].Index = std::uint32_t(bucket.Ids.size());
+
+        bucket.Start.push_back(start);
+        bucket.End.push_back(end);
+        bucket.Duration.push_back(duration);
+        bucket.Elapsed.push_back(elapsed);
+        bucket.Alpha.push_back(alpha);
+        bucket.Value.push_back(EasingFunctions::GetEaseFromType(easeType, start, end, alpha));
+        bucket.Reported.push_back(0);
+        bucket.Ids.push_back(id);
+
+        ++Count;
+        return id;
+    }
+
+    //
+    // Swap-and-pop: the last tween of the bucket moves into the removed slot.
+    //
+    bool Remove(TweenId id)
+    {
+        if (!IsActive(id)) {
+            return false;
+        }
+
+        Bucket& bucket = Buckets[Locations[id].EaseType];
+        const std::size_t index = Locations[id].Index;
+        const std::size_t last = bucket.Ids.size() - 1;
+
+        if (index != last) {
+            bucket.Start[index] = bucket.Start[last];
+            bucket.End[index] = bucket.End[last];
+            bucket.Duration[index] = bucket.Duration[last];
+            bucket.Elapsed[index] = bucket.Elapsed[last];
+            bucket.Alpha[index] = bucket.Alpha[last];
+            bucket.Value[index] = bucket.Value[last];
+            bucket.Reported[index] = bucket.Reported[last];
+            bucket.Ids[index] = bucket.Ids[last];
+
+            Locations[bucket.Ids[index]].Index = std::uint32_t(index);
+        }
+
+        bucket.Start.pop_back();
+        bucket.End.pop_back();
+        bucket.Duration.pop_back();
+        bucket.Elapsed.pop_back();
+        bucket.Alpha.pop_back();
+        bucket.Value.pop_back();
+        bucket.Reported.pop_back();
+        bucket.Ids.pop_back();
+
+        Locations[id].EaseType = EasingFunctions::EASE_TYPE_COUNT;
+        FreeIds.push_back(id);
+
+        --Count;
+        return true;
+    }
+
+    void RemoveCompleted()
+    {
+        for (std::size_t i = 0; i < CompletedCount; ++i) {
+            Remove(Completed[i]);
+        }
+
+        CompletedCount = 0;
+    }
+
+    //
+    // Removes every tween but keeps all memory, so refilling the pool does not allocate.
+    //
+    void Clear()
+    {
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            Bucket& bucket = Buckets[type];
+
+            for (std::size_t i = 0; i < bucket.Ids.size(); ++i) {
+                Locations[bucket.Ids[i]].EaseType = EasingFunctions::EASE_TYPE_COUNT;
+                FreeIds.push_back(bucket.Ids[i]);
+            }
+
+            bucket.Start.clear();
+            bucket.End.clear();
+            bucket.Duration.clear();
+            bucket.Elapsed.clear();
+            bucket.Alpha.clear();
+            bucket.Value.clear();
+            bucket.Reported.clear();
+            bucket.Ids.clear();
+        }
+
+        Count = 0;
+        CompletedCount = 0;
+    }
+
+    //
+    // Advances every tween by deltaTime and re-evaluates its value. The ids of the tweens that reached their duration
+    // in this call, and of those added already finished since the last one, are available from GetCompleted until the
+    // next Update.
+    //
+    void Update(float deltaTime)
+    {
+        CompletedCount = 0;
+
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            Bucket& bucket = Buckets[type];
+
+            CompletedCount += UpdateRange(EEaseType(type), bucket, 0, bucket.Ids.size(), deltaTime, Completed.data() + CompletedCount);
+        }
+    }
+
+    //
+    // Parallel version of Update. Buckets are cut into chunks of chunkSize tweens (rounded up to a whole number of cache
+    // lines of the narrowest bucket array, so no two threads ever write the same line of any of them) and the chunks
+    // are spread over `workers`.
+    //
+    // The result is bit-identical to the single threaded Update, whatever the thread count or chunk size: every value
+    // goes through the same kernel, and each chunk writes its completed ids to its own slice of a scratch list, which is
+    // then packed in bucket and index order. The slices start on a cache line and cover whole lines, like the chunks.
+    //
+    void Update(float deltaTime, EasingWorkerPool& workers, std::size_t chunkSize = 4096)
+    {
+        const std::size_t lineFloats = CacheLineSize / sizeof(float);
+        const std::size_t lineTweens = CacheLineSize / sizeof(std::uint8_t);
+        chunkSize = chunkSize < lineTweens ? lineTweens : (chunkSize + lineTweens - 1) / lineTweens * lineTweens;
+
+        Chunks.clear();
+
+        std::size_t offset = 0;
+
+        for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+            const std::size_t size = Buckets[type].Ids.size();
+
+            for (std::size_t first = 0; first < size; first += chunkSize) {
+                Chunk chunk;
+                chunk.EaseType = EEaseType(type);
+                chunk.First = first;
+                chunk.Last = first + chunkSize < size ? first + chunkSize : size;
+                chunk.CompletedOffset = offset + first;
+                chunk.CompletedCount = 0;
+                Chunks.push_back(chunk);
+            }
+
+            offset += (size + lineFloats - 1) / lineFloats * lineFloats;
+        }
+
+        if (ChunkCompleted.size() < offset) {
+            ChunkCompleted.resize(offset);
+        }
+
+        workers.ParallelFor(Chunks.size(), [this, deltaTime](std::size_t index) {
+            Chunk& chunk = Chunks[index];
+            chunk.CompletedCount = UpdateRange(chunk.EaseType, Buckets[chunk.EaseType], chunk.First, chunk.Last, deltaTime,
+                ChunkCompleted.data() + chunk.CompletedOffset);
+        });
+
+        CompletedCount = 0;
+
+        for (std::size_t i = 0; i < Chunks.size(); ++i) {
+            const TweenId* completed = ChunkCompleted.data() + Chunks[i].CompletedOffset;
+
+            for (std::size_t j = 0; j < Chunks[i].CompletedCount; ++j) {
+                Completed[CompletedCount++] = completed[j];
+            }
+        }
+    }
+
+    bool IsActive(TweenId id) const
+    {
+        return id < Locations.size() && Locations[id].EaseType < EasingFunctions::EASE_TYPE_COUNT;
+    }
+
+    float GetValue(TweenId id) const
+    {
+        return Buckets[Locations[id].EaseType].Value[Locations[id].Index];
+    }
+
+    float GetAlpha(TweenId id) const
+    {
+        return Buckets[Locations[id].EaseType].Alpha[Locations[id].Index];
+    }
+
+    EEaseType GetEaseType(TweenId id) const
+    {
+        return EEaseType(Locations[id].EaseType);
+    }
+
+    const TweenId* GetCompleted() const { return Completed.data(); }
+    std::size_t GetCompletedCount() const { return CompletedCount; }
+
+    std::size_t GetCount() const { return Count; }
+
+    //
+    // Direct access to one bucket, e.g. to copy values out in bulk. Index i of every array is the same tween.
+    //
+    std::size_t GetBucketCount(EEaseType easeType) const { return Buckets[easeType].Ids.size(); }
+    const float* GetBucketValues(EEaseType easeType) const { return Buckets[easeType].Value.data(); }
+    const TweenId* GetBucketIds(EEaseType easeType) const { return Buckets[easeType].Ids.data(); }
+
+private:
+    struct Bucket
+    {
+        AlignedArray<float> Start;
+        AlignedArray<float> End;
+        AlignedArray<float> Duration;
+        AlignedArray<float> Elapsed;
+        AlignedArray<float> Alpha;
+        AlignedArray<float> Value;
+
+        // 1 once the tween has been written to the completed list. Add clears it even for a finished tween, so the
+        // next Update reports that one too.
+        AlignedArray<std::uint8_t> Reported;
+        AlignedArray<TweenId> Ids;
+    };
+
+    //
+    // One per cache line, so the worker that stores CompletedCount does not share the line with its neighbours.
+    //
+    struct alignas(CacheLineSize) Chunk
+    {
+        EEaseType EaseType;
+        std::size_t First;
+        std::size_t Last;
+        std::size_t CompletedOffset;
+        std::size_t CompletedCount;
+    };
+
+    struct Location
+    {
+        std::uint32_t EaseType = EasingFunctions::EASE_TYPE_COUNT;
+        std::uint32_t Index = 0;
+    };
+
+    static float AlphaFromElapsed(float elapsed, float duration)
+    {
+        // A zero length tween is finished as soon as it exists.
+        const float alpha = duration > 0.0f ? elapsed / duration : 1.0f;
+        return alpha < 1.0f ? alpha : 1.0f;
+    }
+
+    //
+    // Updates tweens [first, last) of one bucket and writes the ids of the finished ones not reported yet to
+    // `completed`, in index order. Returns how many were written.
+    //
+    static std::size_t UpdateRange(EEaseType easeType, Bucket& bucket, std::size_t first, std::size_t last, float deltaTime, TweenId* completed)
+    {
+        if (first >= last) {
+            return 0;
+        }
+
+        float* elapsed = bucket.Elapsed.data();
+        float* alpha = bucket.Alpha.data();
+        const float* duration = bucket.Duration.data();
+        std::uint8_t* reported = bucket.Reported.data();
+        const TweenId* ids = bucket.Ids.data();
+
+        std::size_t completedCount = 0;
+
+        for (std::size_t i = first; i < last; ++i) {
+            elapsed[i] += deltaTime;
+            alpha[i] = AlphaFromElapsed(elapsed[i], duration[i]);
+
+            // Only a tween that finished and was not reported yet is written, so the completed list and the flags are
+            // left alone otherwise.
+            if (alpha[i] >= 1.0f && !reported[i]) {
+                completed[completedCount++] = ids[i];
+                reported[i] = 1;
+            }
+        }
+
+        EasingFunctionsSimd::GetEaseFromTypeBatch(easeType, bucket.Start.data() + first, bucket.End.data() + first,
+            alpha + first, bucket.Value.data() + first, last - first);
+
+        return completedCount;
+    }
+
+    Bucket Buckets[EasingFunctions::EASE_TYPE_COUNT];
+
+    std::vector<Location> Locations;
+    std::vector<TweenId> FreeIds;
+
+    std::vector<TweenId> Completed;
+    std::size_t CompletedCount = 0;
+
+    AlignedArray<Chunk> Chunks;
+    AlignedArray<TweenId> ChunkCompleted;
+    std::size_t Count = 0;
+};
@@ -0,0 +1,184 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Easing for vectors, colors and rotations. Every curve in EasingFunctions.hpp is start + (end - start) * weight, where
+ * weight only depends on the curve and alpha. The weight is computed once here and then applied to the whole value, so
+ * a Vec3 costs one curve evaluation instead of one per component:
+ *
+ * Vec3 position = EasingVectors::Ease(EasingFunctions::EASE_OUT_BACK, from, to, 0.67f);
+ * Quat rotation = EasingVectors::EaseQuaternion(EasingFunctions::EASE_IN_OUT_SINE, fromRotation, toRotation, 0.67f);
+ *
+ * Ease works with any type that has +, - and * by a scalar. Types without those operators can specialize
+ * EasingValueTraits. EaseQuaternion slerps along the shortest arc. By default it reads and writes public x, y, z, w
+ * members; specialize EasingQuaternionTraits for anything else. Weights outside [0, 1] (Back, Elastic, Spring)
+ * extrapolate along the same line or arc.
+ */
+
+#pragma once
+
+#include "EasingFunctions.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+template<typename TValue>
+struct EasingValueTraits
+{
+    template<typename T>
+    static TValue Lerp(const TValue& start, const TValue& end, T weight)
+    {
+        return start + (end - start) * weight;
+    }
+};
+
+template<typename TQuaternion>
+struct EasingQuaternionTraits
+{
+    template<typename T>
+    static void Get(const TQuaternion& q, T& x, T& y, T& z, T& w)
+    {
+        x = T(q.x);
+        y = T(q.y);
+        z = T(q.z);
+        w = T(q.w);
+    }
+
+    template<typename T>
+    static void Set(TQuaternion& q, T x, T y, T z, T w)
+    {
+        q.x = x;
+        q.y = y;
+        q.z = z;
+        q.w = w;
+    }
+};
+
+class EasingVectors
+{
+public:
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    //
+    // The normalized curve (start = 0, end = 1) at alpha, i.e. how far along from start to end the value should be.
+    //
+    template<typename T>
+    static constexpr T GetEaseWeight(EEaseType easeType, T alpha)
+    {
+        return EasingFunctions::GetEaseFromType(easeType, T(0.0f), T(1.0f), alpha);
+    }
+
+    template<typename TValue, typename T>
+    static TValue Ease(EEaseType easeType, const TValue& start, const TValue& end, T alpha)
+    {
+        return EasingValueTraits<TValue>::Lerp(start, end, GetEaseWeight(easeType, alpha));
+    }
+
+    template<EEaseType EaseType, typename TValue, typename T>
+    static TValue Ease(const TValue& start, const TValue& end, T alpha)
+    {
+        return EasingValueTraits<TValue>::Lerp(start, end, EasingFunctions::Ease<EaseType>(T(0.0f), T(1.0f), alpha));
+    }
+
+    //
+    // Eases `count` values of the same curve. Weights are computed in blocks on the stack with
+    // GetEaseFromTypeBatch, so the curve runs as a tight loop and nothing is allocated.
+    //
+    // start, end, alpha and out must each point to at least `count` elements. out may alias start or end.
+    //
+    template<typename TValue, typename T>
+    static void EaseBatch(EEaseType easeType, const TValue* start, const TValue* end, const T* alpha, TValue* out, std::size_t count)
+    {
+        const std::size_t blockSize = 256;
+
+        T zeros[blockSize];
+        T ones[blockSize];
+        T weights[blockSize];
+
+        for (std::size_t i = 0; i < blockSize; ++i) {
+            zeros[i] = T(0.0f);
+            ones[i] = T(1.0f);
+        }
+
+        for (std::size_t first = 0; first < count; first += blockSize) {
+            const std::size_t size = count - first < blockSize ? count - first : blockSize;
+
+            EasingFunctions::GetEaseFromTypeBatch(easeType, zeros, ones, alpha + first, weights, size);
+
+            for (std::size_t i = 0; i < size; ++i) {
+                out[first + i] = EasingValueTraits<TValue>::Lerp(start[first + i], end[first + i], weights[i]);
+            }
+        }
+    }
+
+    //
+    // Spherical interpolation from start to end by the eased weight, along the shorter of the two arcs. Both inputs
+    // are expected to be unit quaternions; the result is one as well.
+    //
+    template<typename TQuaternion, typename T>
+    static TQuaternion EaseQuaternion(EEaseType easeType, const TQuaternion& start, const TQuaternion& end, T alpha)
+    {
+        return Slerp(start, end, GetEaseWeight(easeType, alpha));
+    }
+
+    template<EEaseType EaseType, typename TQuaternion, typename T>
+    static TQuaternion EaseQuaternion(const TQuaternion& start, const TQuaternion& end, T alpha)
+    {
+        return Slerp(start, end, EasingFunctions::Ease<EaseType>(T(0.0f), T(1.0f), alpha));
+    }
+
+    template<typename TQuaternion, typename T>
+    static TQuaternion Slerp(const TQuaternion& start, const TQuaternion& end, T weight)
+    {
+        T ax = T(0.0f), ay = T(0.0f), az = T(0.0f), aw = T(0.0f);
+        T bx = T(0.0f), by = T(0.0f), bz = T(0.0f), bw = T(0.0f);
+
+        EasingQuaternionTraits<TQuaternion>::Get(start, ax, ay, az, aw);
+        EasingQuaternionTraits<TQuaternion>::Get(end, bx, by, bz, bw);
+
+        T cosTheta = ax * bx + ay * by + az * bz + aw * bw;
+
+        // q and -q are the same rotation; flip end so the path takes the short way round.
+        if (cosTheta < T(0.0f)) {
+            bx = -bx;
+            by = -by;
+            bz = -bz;
+            bw = -bw;
+            cosTheta = -cosTheta;
+        }
+
+        T startScale = T(1.0f) - weight;
+        T endScale = weight;
+
+        // Nearly parallel: sin(theta) is too small to divide by, and a normalized lerp is indistinguishable.
+        if (cosTheta < T(0.9995f)) {
+            const T theta = std::acos(cosTheta);
+            const T sinTheta = std::sin(theta);
+
+            startScale = std::sin(startScale * theta) / sinTheta;
+            endScale = std::sin(endScale * theta) / sinTheta;
+        }
+
+        T x = startScale * ax + endScale * bx;
+        T y = startScale * ay + endScale * by;
+        T z = startScale * az + endScale * bz;
+        T w = startScale * aw + endScale * bw;
+
+        const T length = std::sqrt(x * x + y * y + z * z + w * w);
+
+        if (length > T(0.0f)) {
+            x /= length;
+            y /= length;
+            z /= length;
+            w /= length;
+        }
+
+        TQuaternion result = start;
+        EasingQuaternionTraits<TQuaternion>::Set(result, x, y, z, w);
+        return result;
+    }
+};
@@ -0,0 +1,219 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * A small fork-join thread pool with work stealing, used by EasingTweenPool::Update to spread tween buckets over
+ * several cores.
+ *
+ * EasingWorkerPool workers(8);
+ *
+ * workers.ParallelFor(taskCount, [&](std::size_t task) { ... });
+ *
+ * ParallelFor blocks until every task has run; the calling thread works too, so a pool of N threads starts N - 1.
+ * Tasks are dealt out as one contiguous range per thread. A thread takes tasks from the front of its own range and,
+ * once that is empty, steals from the back of the others. Each range is a single 64 bit atomic on its own cache line,
+ * so handing out a task is one compare-and-swap and nothing is allocated per call.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+class EasingWorkerPool
+{
+public:
+    static const std::size_t CacheLineSize = 64;
+
+    //
+    // threadCount includes the thread that calls ParallelFor. 0 uses one thread per hardware thread.
+    //
+    explicit EasingWorkerPool(unsigned int threadCount = 0)
+    {
+        if (threadCount == 0) {
+            threadCount = std::thread::hardware_concurrency();
+        }
+
+        ThreadCount = threadCount > 0 ? threadCount : 1;
+        Queues.reset(new WorkerQueue[ThreadCount]);
+
+        for (unsigned int i = 1; i < ThreadCount; ++i) {
+            Threads.emplace_back(&EasingWorkerPool::WorkerMain, this, i);
+        }
+    }
+
+    ~EasingWorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            Stopping = true;
+        }
+
+        WakeCondition.notify_all();
+
+        for (std::size_t i = 0; i < Threads.size(); ++i) {
+            Threads[i].join();
+        }
+    }
+
+    EasingWorkerPool(const EasingWorkerPool&) = delete;
+    EasingWorkerPool& operator=(const EasingWorkerPool&) = delete;
+
+    unsigned int GetThreadCount() const { return ThreadCount; }
+
+    //
+    // Runs func(task) for every task in [0, taskCount) and returns when all of them have finished. func must be safe to
+    // call from several threads at once. Not reentrant: do not call ParallelFor from inside a task.
+    //
+    template<typename TFunc>
+    void ParallelFor(std::size_t taskCount, TFunc&& func)
+    {
+        if (taskCount == 0) {
+            return;
+        }
+
+        if (ThreadCount == 1 || taskCount == 1) {
+            for (std::size_t task = 0; task < taskCount; ++task) {
+                func(task);
+            }
+            return;
+        }
+
+        // Deal the tasks out as evenly sized contiguous ranges, one per thread.
+        for (unsigned int i = 0; i < ThreadCount; ++i) {
+            const std::uint64_t begin = taskCount * i / ThreadCount;
+            const std::uint64_t end = taskCount * (i + 1) / ThreadCount;
+            Queues[i].Range.store(PackRange(begin, end), std::memory_order_relaxed);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            Task = const_cast<void*>(static_cast<const void*>(&func));
+            RunTask = &InvokeTask<typename std::remove_reference<TFunc>::type>;
+            PendingWorkers = ThreadCount - 1;
+            ++Generation;
+        }
+
+        WakeCondition.notify_all();
+
+        RunTasks(0);
+
+        std::unique_lock<std::mutex> lock(Mutex);
+        DoneCondition.wait(lock, [this]() { return PendingWorkers == 0; });
+    }
+
+private:
+    // Padded rather than aligned so new[] does not need C++17 over-aligned allocation: two ranges 64 bytes apart can
+    // never share a cache line.
+    struct WorkerQueue
+    {
+        std::atomic<std::uint64_t> Range{ 0 };
+        char Padding[CacheLineSize - sizeof(std::atomic<std::uint64_t>)];
+    };
+
+    static std::uint64_t PackRange(std::uint64_t begin, std::uint64_t end)
+    {
+        return begin | (end << 32);
+    }
+
+    template<typename TFunc>
+    static void InvokeTask(void* func, std::size_t task)
+    {
+        (*static_cast<TFunc*>(func))(task);
+    }
+
+    //
+    // Takes one task from the front (owner) or the back (thief) of a range.
+    //
+    static bool TakeTask(WorkerQueue& queue, bool fromFront, std::size_t& task)
+    {
+        std::uint64_t range = queue.Range.load(std::memory_order_relaxed);
+
+        for (;;) {
+            const std::uint64_t begin = range & 0xFFFFFFFFu;
+            const std::uint64_t end = range >> 32;
+
+            if (begin >= end) {
+                return false;
+            }
+
+            const std::uint64_t next = fromFront ? PackRange(begin + 1, end) : PackRange(begin, end - 1);
+
+            if (queue.Range.compare_exchange_weak(range, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                task = std::size_t(fromFront ? begin : end - 1);
+                return true;
+            }
+        }
+    }
+
+    void RunTasks(unsigned int self)
+    {
+        std::size_t task = 0;
+
+        while (TakeTask(Queues[self], true, task)) {
+            RunTask(Task, task);
+        }
+
+        // Own range is empty: steal from the others, starting with the next thread so thieves spread out.
+        for (unsigned int offset = 1; offset < ThreadCount; ++offset) {
+            WorkerQueue& victim = Queues[(self + offset) % ThreadCount];
+
+            while (TakeTask(victim, false, task)) {
+                RunTask(Task, task);
+            }
+        }
+    }
+
+    void WorkerMain(unsigned int self)
+    {
+        std::uint64_t seenGeneration = 0;
+
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(Mutex);
+                WakeCondition.wait(lock, [&]() { return Stopping || Generation != seenGeneration; });
+
+                if (Stopping) {
+                    return;
+                }
+
+                seenGeneration = Generation;
+            }
+
+            RunTasks(self);
+
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+
+                if (--PendingWorkers == 0) {
+                    DoneCondition.notify_one();
+                }
+            }
+        }
+    }
+
+    unsigned int ThreadCount = 1;
+    std::unique_ptr<WorkerQueue[]> Queues;
+    std::vector<std::thread> Threads;
+
+    std::mutex Mutex;
+    std::condition_variable WakeCondition;
+    std::condition_variable DoneCondition;
+
+    void* Task = nullptr;
+    void (*RunTask)(void*, std::size_t) = nullptr;
+    unsigned int PendingWorkers = 0;
+    std::uint64_t Generation = 0;
+    bool Stopping = false;
+};
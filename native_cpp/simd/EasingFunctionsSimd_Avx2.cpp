@@ -0,0 +1,23 @@
+//
+// AVX2 kernel unit for EASING_SIMD_DISPATCH_UNITS builds. Compile with -mavx2, or /arch:AVX2 with MSVC.
+//
+
+#if !defined(EASING_SIMD_DISPATCH_UNITS)
+    #define EASING_SIMD_DISPATCH_UNITS
+#endif
+
+#include "../EasingFunctionsSimd.hpp"
+
+#if !defined(EASING_SIMD_HAS_AVX2)
+    #error "EasingFunctionsSimd_Avx2.cpp must be compiled with AVX2 enabled"
+#endif
+
+void EasingFunctionsSimd::GetEaseFromTypeBatchAvx2(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetEaseFromTypeLanes<EaseLaneAvx2>(easeType, start, end, alpha, out, count);
+}
+
+void EasingFunctionsSimd::GetCubicBezierBatchAvx2(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetCubicBezierLanes<EaseLaneAvx2>(bezier, start, end, alpha, out, count);
+}
@@ -0,0 +1,23 @@
+//
+// AVX512 kernel unit for EASING_SIMD_DISPATCH_UNITS builds. Compile with -mavx512f, or /arch:AVX512 with MSVC.
+//
+
+#if !defined(EASING_SIMD_DISPATCH_UNITS)
+    #define EASING_SIMD_DISPATCH_UNITS
+#endif
+
+#include "../EasingFunctionsSimd.hpp"
+
+#if !defined(EASING_SIMD_HAS_AVX512)
+    #error "EasingFunctionsSimd_Avx512.cpp must be compiled with AVX512 enabled"
+#endif
+
+void EasingFunctionsSimd::GetEaseFromTypeBatchAvx512(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetEaseFromTypeLanes<EaseLaneAvx512>(easeType, start, end, alpha, out, count);
+}
+
+void EasingFunctionsSimd::GetCubicBezierBatchAvx512(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetCubicBezierLanes<EaseLaneAvx512>(bezier, start, end, alpha, out, count);
+}
@@ -0,0 +1,23 @@
+//
+// NEON kernel unit for EASING_SIMD_DISPATCH_UNITS builds. Compile with nothing extra on AArch64.
+//
+
+#if !defined(EASING_SIMD_DISPATCH_UNITS)
+    #define EASING_SIMD_DISPATCH_UNITS
+#endif
+
+#include "../EasingFunctionsSimd.hpp"
+
+#if !defined(EASING_SIMD_HAS_NEON)
+    #error "EasingFunctionsSimd_Neon.cpp must be compiled with NEON enabled"
+#endif
+
+void EasingFunctionsSimd::GetEaseFromTypeBatchNeon(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetEaseFromTypeLanes<EaseLaneNeon>(easeType, start, end, alpha, out, count);
+}
+
+void EasingFunctionsSimd::GetCubicBezierBatchNeon(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetCubicBezierLanes<EaseLaneNeon>(bezier, start, end, alpha, out, count);
+}
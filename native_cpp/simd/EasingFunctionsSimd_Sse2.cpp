@@ -0,0 +1,23 @@
+//
+// SSE2 kernel unit for EASING_SIMD_DISPATCH_UNITS builds. Compile with -msse2 (implied on x86-64), no flag needed with MSVC.
+//
+
+#if !defined(EASING_SIMD_DISPATCH_UNITS)
+    #define EASING_SIMD_DISPATCH_UNITS
+#endif
+
+#include "../EasingFunctionsSimd.hpp"
+
+#if !defined(EASING_SIMD_HAS_SSE2)
+    #error "EasingFunctionsSimd_Sse2.cpp must be compiled with SSE2 enabled"
+#endif
+
+void EasingFunctionsSimd::GetEaseFromTypeBatchSse2(EEaseType easeType, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetEaseFromTypeLanes<EaseLaneSse2>(easeType, start, end, alpha, out, count);
+}
+
+void EasingFunctionsSimd::GetCubicBezierBatchSse2(const EasingCubicBezier& bezier, const float* start, const float* end, const float* alpha, float* out, std::size_t count)
+{
+    GetCubicBezierLanes<EaseLaneSse2>(bezier, start, end, alpha, out, count);
+}
@@ -0,0 +1,532 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Accuracy report for every evaluation path in native_cpp against a long double reference of the same formulas.
+ * For each curve (start = 0, end = 1) over a dense grid of alphas in [0, 1] it reports:
+ *
+ *   max_abs_error     largest |path - reference|
+ *   max_ulp_error     the same in float ULPs at the reference value. The spacing is floored at 2^-24, the ULP of
+ *                     the [0.5, 1) output range, so values near zero are not reported as millions of ULPs off
+ *   max_joint_jump    at every join of a piecewise curve (the InOut midpoint, the Bounce segments), how much more
+ *                     the path jumps between the two float alphas around the join than the reference does
+ *
+ * and, for the derivative paths, max_rel_error of GetEaseDerivativeFromType and of the fused velocity against a central
+ * difference of the reference, away from the joins and the vertical Circ tangents.
+ *
+ * Paths: scalar (GetEaseFromType<float>), double and long_double (GetEaseFromType<double> and <long double>, and the
+ * double derivative), fused (GetEaseWithVelocityFromType), simd (EasingFunctionsSimd at the widest level compiled
+ * in), EasingCurveTable at several resolutions, and the EasingFixedPoint curves in Q16.16 and Q32.32. The double, long
+ * double and fixed point paths are unrounded, so their error is not capped by float. Build with
+ * -DEASING_FAST_MATH to measure the polynomial math mode instead of libm.
+ *
+ *   g++ -std=c++17 -O2 -Inative_cpp tests/NativeCpp_accuracy.cpp -o NativeCpp_accuracy
+ *   ./NativeCpp_accuracy [--samples=<count>] [--json=<file>]
+ */
+
+#include "EasingCurveTable.hpp"
+#include "EasingFixedPoint.hpp"
+#include "EasingFunctions.hpp"
+#include "EasingFunctionsSimd.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace
+{
+    typedef EasingFunctions::EEaseType EEaseType;
+    typedef long double Real;
+
+    const char* const EaseNames[EasingFunctions::EASE_TYPE_COUNT] =
+    {
+        "Linear", "Spring",
+        "InQuad", "OutQuad", "InOutQuad",
+        "InCubic", "OutCubic", "InOutCubic",
+        "InQuart", "OutQuart", "InOutQuart",
+        "InQuint", "OutQuint", "InOutQuint",
+        "InSine", "OutSine", "InOutSine",
+        "InExpo", "OutExpo", "InOutExpo",
+        "InCirc", "OutCirc", "InOutCirc",
+        "InBounce", "OutBounce", "InOutBounce",
+        "InBack", "OutBack", "InOutBack",
+        "InElastic", "OutElastic", "InOutElastic"
+    };
+
+    const Real Pi = 3.141592653589793238462643383279502884L;
+
+    /// Reference curves ///
+
+    Real OutBounce(Real t)
+    {
+        if (t < 1.0L / 2.75L) {
+            return 7.5625L * t * t;
+        } else if (t < 2.0L / 2.75L) {
+            t -= 1.5L / 2.75L;
+            return 7.5625L * t * t + 0.75L;
+        } else if (t < 2.5L / 2.75L) {
+            t -= 2.25L / 2.75L;
+            return 7.5625L * t * t + 0.9375L;
+        }
+
+        t -= 2.625L / 2.75L;
+        return 7.5625L * t * t + 0.984375L;
+    }
+
+    Real ElasticWave(Real u)
+    {
+        const Real p = 0.3L;
+        const Real s = p / 4.0L;
+        return std::sin((u - s) * (2.0L * Pi) / p);
+    }
+
+    //
+    // The unit curves, written out independently of EasingFunctions.hpp from the same formulas.
+    //
+    Real Reference(EEaseType easeType, Real t)
+    {
+        const Real back = 1.70158L;
+        const Real backInOut = back * 1.525L;
+        const Real h = 2.0L * t;
+
+        switch (easeType)
+        {
+            case EasingFunctions::EASE_LINEAR:
+                return t;
+
+            case EasingFunctions::EASE_SPRING:
+                t = t < 0.0L ? 0.0L : (t > 1.0L ? 1.0L : t);
+                return (std::sin(Pi * t * (0.2L + 2.5L * t * t * t)) * std::pow(1.0L - t, 2.2L) + t) * (1.0L + 1.2L * (1.0L - t));
+
+            case EasingFunctions::EASE_IN_QUAD:
+                return t * t;
+            case EasingFunctions::EASE_OUT_QUAD:
+                return 1.0L - (1.0L - t) * (1.0L - t);
+            case EasingFunctions::EASE_IN_OUT_QUAD:
+                return h < 1.0L ? 0.5L * h * h : 1.0L - 0.5L * (2.0L - h) * (2.0L - h);
+
+            case EasingFunctions::EASE_IN_CUBIC:
+                return std::pow(t, 3.0L);
+            case EasingFunctions::EASE_OUT_CUBIC:
+                return 1.0L - std::pow(1.0L - t, 3.0L);
+            case EasingFunctions::EASE_IN_OUT_CUBIC:
+                return h < 1.0L ? 0.5L * std::pow(h, 3.0L) : 1.0L - 0.5L * std::pow(2.0L - h, 3.0L);
+
+            case EasingFunctions::EASE_IN_QUART:
+                return std::pow(t, 4.0L);
+            case EasingFunctions::EASE_OUT_QUART:
+                return 1.0L - std::pow(1.0L - t, 4.0L);
+            case EasingFunctions::EASE_IN_OUT_QUART:
+                return h < 1.0L ? 0.5L * std::pow(h, 4.0L) : 1.0L - 0.5L * std::pow(2.0L - h, 4.0L);
+
+            case EasingFunctions::EASE_IN_QUINT:
+                return std::pow(t, 5.0L);
+            case EasingFunctions::EASE_OUT_QUINT:
+                return 1.0L - std::pow(1.0L - t, 5.0L);
+            case EasingFunctions::EASE_IN_OUT_QUINT:
+                return h < 1.0L ? 0.5L * std::pow(h, 5.0L) : 1.0L - 0.5L * std::pow(2.0L - h, 5.0L);
+
+            case EasingFunctions::EASE_IN_SINE:
+                return 1.0L - std::cos(t * Pi * 0.5L);
+            case EasingFunctions::EASE_OUT_SINE:
+                return std::sin(t * Pi * 0.5L);
+            case EasingFunctions::EASE_IN_OUT_SINE:
+                return 0.5L * (1.0L - std::cos(Pi * t));
+
+            case EasingFunctions::EASE_IN_EXPO:
+                return std::exp2(10.0L * (t - 1.0L));
+            case EasingFunctions::EASE_OUT_EXPO:
+                return 1.0L - std::exp2(-10.0L * t);
+            case EasingFunctions::EASE_IN_OUT_EXPO:
+                return h < 1.0L ? 0.5L * std::exp2(10.0L * (h - 1.0L)) : 0.5L * (2.0L - std::exp2(-10.0L * (h - 1.0L)));
+
+            case EasingFunctions::EASE_IN_CIRC:
+                return 1.0L - std::sqrt(1.0L - t * t);
+            case EasingFunctions::EASE_OUT_CIRC:
+                return std::sqrt(1.0L - (t - 1.0L) * (t - 1.0L));
+            case EasingFunctions::EASE_IN_OUT_CIRC:
+                return h < 1.0L ? 0.5L * (1.0L - std::sqrt(1.0L - h * h)) : 0.5L * (std::sqrt(1.0L - (h - 2.0L) * (h - 2.0L)) + 1.0L);
+
+            case EasingFunctions::EASE_IN_BOUNCE:
+                return 1.0L - OutBounce(1.0L - t);
+            case EasingFunctions::EASE_OUT_BOUNCE:
+                return OutBounce(t);
+            case EasingFunctions::EASE_IN_OUT_BOUNCE:
+                return t < 0.5L ? 0.5L * (1.0L - OutBounce(1.0L - h)) : 0.5L * OutBounce(h - 1.0L) + 0.5L;
+
+            case EasingFunctions::EASE_IN_BACK:
+                return t * t * ((back + 1.0L) * t - back);
+            case EasingFunctions::EASE_OUT_BACK:
+                return (t - 1.0L) * (t - 1.0L) * ((back + 1.0L) * (t - 1.0L) + back) + 1.0L;
+            case EasingFunctions::EASE_IN_OUT_BACK:
+                return h < 1.0L ? 0.5L * h * h * ((backInOut + 1.0L) * h - backInOut)
+                    : 0.5L * ((h - 2.0L) * (h - 2.0L) * ((backInOut + 1.0L) * (h - 2.0L) + backInOut) + 2.0L);
+
+            case EasingFunctions::EASE_IN_ELASTIC:
+                if (t == 0.0L || t == 1.0L) {
+                    return t;
+                }
+                return -std::exp2(10.0L * (t - 1.0L)) * ElasticWave(t - 1.0L);
+            case EasingFunctions::EASE_OUT_ELASTIC:
+                if (t == 0.0L || t == 1.0L) {
+                    return t;
+                }
+                return std::exp2(-10.0L * t) * ElasticWave(t) + 1.0L;
+            case EasingFunctions::EASE_IN_OUT_ELASTIC:
+                if (t == 0.0L || t == 1.0L) {
+                    return t;
+                }
+                return h < 1.0L ? -0.5L * std::exp2(10.0L * (h - 1.0L)) * ElasticWave(h - 1.0L)
+                    : 0.5L * std::exp2(-10.0L * (h - 1.0L)) * ElasticWave(h - 1.0L) + 1.0L;
+
+            default:
+                return 0.0L;
+        }
+    }
+
+    //
+    // Alphas where a curve switches formula.
+    //
+    std::vector<Real> GetJoints(EEaseType easeType)
+    {
+        const Real bounce[] = { 1.0L / 2.75L, 2.0L / 2.75L, 2.5L / 2.75L };
+        std::vector<Real> joints;
+
+        switch (easeType)
+        {
+            case EasingFunctions::EASE_OUT_BOUNCE:
+                joints.assign(bounce, bounce + 3);
+                break;
+
+            case EasingFunctions::EASE_IN_BOUNCE:
+                for (Real joint : bounce) {
+                    joints.push_back(1.0L - joint);
+                }
+                break;
+
+            case EasingFunctions::EASE_IN_OUT_BOUNCE:
+                joints.push_back(0.5L);
+                for (Real joint : bounce) {
+                    joints.push_back(0.5L * (1.0L - joint));
+                    joints.push_back(0.5L * (1.0L + joint));
+                }
+                break;
+
+            case EasingFunctions::EASE_IN_OUT_QUAD:
+            case EasingFunctions::EASE_IN_OUT_CUBIC:
+            case EasingFunctions::EASE_IN_OUT_QUART:
+            case EasingFunctions::EASE_IN_OUT_QUINT:
+            case EasingFunctions::EASE_IN_OUT_EXPO:
+            case EasingFunctions::EASE_IN_OUT_CIRC:
+            case EasingFunctions::EASE_IN_OUT_BACK:
+            case EasingFunctions::EASE_IN_OUT_ELASTIC:
+                joints.push_back(0.5L);
+                break;
+
+            default:
+                break;
+        }
+
+        return joints;
+    }
+
+    /// Paths ///
+
+    struct Path
+    {
+        std::string Name;
+        bool IsBatch;
+        Real (*Evaluate)(EEaseType, float);
+    };
+
+    Real EvaluateScalar(EEaseType easeType, float alpha)
+    {
+        return EasingFunctions::GetEaseFromType(easeType, 0.0f, 1.0f, alpha);
+    }
+
+    //
+    // The double and long double curves compute in their own precision, so they are returned unrounded like the fixed
+    // point ones below; their error is then that of the libm calls and of T itself.
+    //
+    Real EvaluateDouble(EEaseType easeType, float alpha)
+    {
+        return EasingFunctions::GetEaseFromType(easeType, 0.0, 1.0, double(alpha));
+    }
+
+    Real EvaluateLongDouble(EEaseType easeType, float alpha)
+    {
+        return EasingFunctions::GetEaseFromType(easeType, 0.0L, 1.0L, Real(alpha));
+    }
+
+    Real EvaluateFused(EEaseType easeType, float alpha)
+    {
+        return EasingFunctions::GetEaseWithVelocityFromType(easeType, 0.0f, 1.0f, alpha).Value;
+    }
+
+    Real EvaluateSimd(EEaseType easeType, float alpha)
+    {
+        const float start = 0.0f;
+        const float end = 1.0f;
+        float out = 0.0f;
+
+        EasingFunctionsSimd::GetEaseFromTypeBatch(easeType, &start, &end, &alpha, &out, 1);
+        return out;
+    }
+
+    Real DerivativeScalar(EEaseType easeType, float alpha)
+    {
+        return EasingFunctions::GetEaseDerivativeFromType(easeType, 0.0f, 1.0f, alpha);
+    }
+
+    Real DerivativeDouble(EEaseType easeType, float alpha)
+    {
+        return EasingFunctions::GetEaseDerivativeFromType(easeType, 0.0, 1.0, double(alpha));
+    }
+
+    Real DerivativeFused(EEaseType easeType, float alpha)
+    {
+        return EasingFunctions::GetEaseWithVelocityFromType(easeType, 0.0f, 1.0f, alpha).Velocity;
+    }
+
+    //
+    // Fixed point results are returned unrounded, so the Q32.32 error is not hidden under the float rounding. The
+    // grid alphas are multiples of 1 / samples, exact in both formats for the power of two sample counts.
+    //
+    template<typename TFixed>
+    Real EvaluateFixed(EEaseType easeType, float alpha)
+    {
+        return Real(EasingFixedPoint::GetEaseFromType(easeType, TFixed::FromInt(0), TFixed::FromInt(1), TFixed::FromDouble(alpha)).ToDouble());
+    }
+
+    template<typename TFixed>
+    Real DerivativeFixed(EEaseType easeType, float alpha)
+    {
+        return Real(EasingFixedPoint::GetEaseDerivativeFromType(easeType, TFixed::FromInt(0), TFixed::FromInt(1), TFixed::FromDouble(alpha)).ToDouble());
+    }
+
+    //
+    // Tables are rebuilt per curve, so they are evaluated through this small cache instead of a plain function.
+    //
+    template<std::size_t Resolution, EEaseTableInterpolation Interpolation>
+    Real EvaluateTable(EEaseType easeType, float alpha)
+    {
+        static EasingCurveTable<Resolution>* table = nullptr;
+
+        if (table == nullptr || table->GetEaseType() != easeType) {
+            delete table;
+            table = new EasingCurveTable<Resolution>(easeType, Interpolation);
+        }
+
+        return table->Sample(alpha);
+    }
+
+    struct Stats
+    {
+        double MaxAbsError = 0.0;
+        double MaxUlpError = 0.0;
+        double MaxJointJump = 0.0;
+        double WorstAlpha = 0.0;
+    };
+
+    double UlpError(Real value, Real reference)
+    {
+        // Float spacing at the reference, floored at 2^-24 (see the description at the top).
+        const float magnitude = std::fabs(float(reference));
+        const float spacing = std::nextafter(magnitude, std::numeric_limits<float>::infinity()) - magnitude;
+        const double ulp = spacing > 5.9604644775390625e-8f ? double(spacing) : 5.9604644775390625e-8;
+
+        return double(std::fabs(Real(value) - reference)) / ulp;
+    }
+
+    Stats MeasureValue(EEaseType easeType, Real (*evaluate)(EEaseType, float), std::size_t samples)
+    {
+        Stats stats;
+
+        for (std::size_t i = 0; i <= samples; ++i) {
+            const float alpha = float(i) / float(samples);
+            const Real value = evaluate(easeType, alpha);
+            const Real reference = Reference(easeType, Real(alpha));
+            const double error = double(std::fabs(Real(value) - reference));
+
+            if (!(error <= stats.MaxAbsError)) {
+                stats.MaxAbsError = error;
+                stats.WorstAlpha = alpha;
+            }
+
+            const double ulps = UlpError(value, reference);
+            stats.MaxUlpError = ulps > stats.MaxUlpError || ulps != ulps ? ulps : stats.MaxUlpError;
+        }
+
+        for (Real joint : GetJoints(easeType)) {
+            // The float alphas either side of the join, and how much the path jumps between them beyond the reference.
+            const float above = std::nextafter(float(joint), 2.0f);
+            const float below = std::nextafter(float(joint), -1.0f);
+
+            const Real pathJump = Real(evaluate(easeType, above)) - Real(evaluate(easeType, below));
+            const Real referenceJump = Reference(easeType, Real(above)) - Reference(easeType, Real(below));
+            const double excess = double(std::fabs(pathJump - referenceJump));
+
+            stats.MaxJointJump = excess > stats.MaxJointJump ? excess : stats.MaxJointJump;
+        }
+
+        return stats;
+    }
+
+    Stats MeasureDerivative(EEaseType easeType, Real (*derivative)(EEaseType, float), std::size_t samples)
+    {
+        const Real h = 1e-6L;
+        const std::vector<Real> joints = GetJoints(easeType);
+        Stats stats;
+
+        for (std::size_t i = 0; i <= samples; ++i) {
+            const float alpha = float(i) / float(samples);
+            const Real a = Real(alpha);
+
+            // Central differences are meaningless across a join, and at the ends of the Spring clamp and Elastic snaps.
+            bool nearJoint = a - h < 0.0L || a + h > 1.0L;
+            for (Real joint : joints) {
+                nearJoint = nearJoint || std::fabs(a - joint) < 4.0L * h;
+            }
+
+            if (nearJoint) {
+                continue;
+            }
+
+            const Real reference = (Reference(easeType, a + h) - Reference(easeType, a - h)) / (2.0L * h);
+
+            // Skip the vertical Circ tangents, where the slope is unbounded.
+            if (std::fabs(reference) > 1e3L) {
+                continue;
+            }
+
+            const double error = double(std::fabs(Real(derivative(easeType, alpha)) - reference) / (1.0L + std::fabs(reference)));
+
+            if (!(error <= stats.MaxAbsError)) {
+                stats.MaxAbsError = error;
+                stats.WorstAlpha = alpha;
+            }
+        }
+
+        return stats;
+    }
+
+    bool ParseOption(const char* argument, const char* prefix, std::string& value)
+    {
+        const std::size_t length = std::strlen(prefix);
+
+        if (std::strncmp(argument, prefix, length) != 0) {
+            return false;
+        }
+
+        value = argument + length;
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::size_t samples = 65536;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string value;
+
+        if (ParseOption(argv[i], "--samples=", value)) {
+            samples = std::size_t(std::strtoull(value.c_str(), nullptr, 10));
+        } else if (ParseOption(argv[i], "--json=", value)) {
+            jsonPath = value;
+        } else {
+            std::fprintf(stderr, "usage: %s [--samples=<count>] [--json=<file>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    const Path valuePaths[] =
+    {
+        { "scalar", false, &EvaluateScalar },
+        { "double", false, &EvaluateDouble },
+        { "long_double", false, &EvaluateLongDouble },
+        { "fused", false, &EvaluateFused },
+        { "simd", true, &EvaluateSimd },
+        { "table_linear_1024", false, &EvaluateTable<1024, EASE_TABLE_LINEAR> },
+        { "table_hermite_256", false, &EvaluateTable<256, EASE_TABLE_HERMITE> },
+        { "table_hermite_1024", false, &EvaluateTable<1024, EASE_TABLE_HERMITE> },
+        { "table_hermite_4096", false, &EvaluateTable<4096, EASE_TABLE_HERMITE> },
+        { "fixed_q16", false, &EvaluateFixed<EasingQ16> },
+        { "fixed_q32", false, &EvaluateFixed<EasingQ32> }
+    };
+
+    const Path derivativePaths[] =
+    {
+        { "derivative", false, &DerivativeScalar },
+        { "double_derivative", false, &DerivativeDouble },
+        { "fused_velocity", false, &DerivativeFused },
+        { "fixed_q16_derivative", false, &DerivativeFixed<EasingQ16> },
+        { "fixed_q32_derivative", false, &DerivativeFixed<EasingQ32> }
+    };
+
+    FILE* json = jsonPath.empty() ? nullptr : std::fopen(jsonPath.c_str(), "w");
+
+    if (!jsonPath.empty() && json == nullptr) {
+        std::fprintf(stderr, "could not open %s\n", jsonPath.c_str());
+        return 1;
+    }
+
+    if (json != nullptr) {
+        std::fprintf(json, "{\n  \"context\": {\"samples\": %zu, ", samples);
+#if defined(EASING_FAST_MATH)
+        std::fprintf(json, "\"fast_math\": true},\n");
+#else
+        std::fprintf(json, "\"fast_math\": false},\n");
+#endif
+        std::fprintf(json, "  \"results\": [\n");
+    }
+
+    std::printf("%-14s %-20s %12s %12s %12s %10s\n", "curve", "path", "max_abs", "max_ulp", "joint_jump", "worst_at");
+
+    bool first = true;
+
+    for (unsigned int type = 0; type < EasingFunctions::EASE_TYPE_COUNT; ++type) {
+        const EEaseType easeType = EEaseType(type);
+
+        for (const Path& path : valuePaths) {
+            const Stats stats = MeasureValue(easeType, path.Evaluate, samples);
+
+            std::printf("%-14s %-20s %12.3e %12.1f %12.3e %10.6f\n", EaseNames[type], path.Name.c_str(),
+                stats.MaxAbsError, stats.MaxUlpError, stats.MaxJointJump, stats.WorstAlpha);
+
+            if (json != nullptr) {
+                std::fprintf(json, "%s    {\"curve\": \"%s\", \"path\": \"%s\", \"max_abs_error\": %.9g, \"max_ulp_error\": %.6g, \"max_joint_jump\": %.9g, \"worst_alpha\": %.9g}",
+                    first ? "" : ",\n", EaseNames[type], path.Name.c_str(), stats.MaxAbsError, stats.MaxUlpError, stats.MaxJointJump, stats.WorstAlpha);
+                first = false;
+            }
+        }
+
+        for (const Path& path : derivativePaths) {
+            const Stats stats = MeasureDerivative(easeType, path.Evaluate, samples);
+
+            std::printf("%-14s %-20s %12.3e %12s %12s %10.6f\n", EaseNames[type], path.Name.c_str(), stats.MaxAbsError, "-", "-", stats.WorstAlpha);
+
+            if (json != nullptr) {
+                std::fprintf(json, ",\n    {\"curve\": \"%s\", \"path\": \"%s\", \"max_rel_error\": %.9g, \"worst_alpha\": %.9g}",
+                    EaseNames[type], path.Name.c_str(), stats.MaxAbsError, stats.WorstAlpha);
+            }
+        }
+    }
+
+    if (json != nullptr) {
+        std::fprintf(json, "\n  ]\n}\n");
+        std::fclose(json);
+    }
+
+    return 0;
+}
@@ -0,0 +1,1398 @@
+/*
+ * The MIT License (MIT)
+ *
+ * See LICENSE.txt in the root of this repository for the full license text.
+ *
+ *
+ * ============= Description =============
+ *
+ * Unit tests for native_cpp/EasingFunctions.hpp. The ease cases mirror tests/NativePython_test.py (start = 0, end = 1,
+ * alpha = 0, 1 and 0.5), with a few quarter points added. Where the Python port disagrees with the C++ formulas
+ * (InBounce at 0.5 and 1, InElastic and InOutElastic at 0.5), the expected value is the one from the formula.
+ *
+ * Every case is checked through GetEaseFromType for float and double, Ease<E>, the GetEasingFunction table,
+ * GetEaseFromTypeBatch, the SIMD batch and the fused GetEaseWithVelocityFromType. Derivatives are checked against known
+ * values and against a central difference of their curve. GetEaseInverseFromType is checked for a round trip through
+ * every curve and for returning the first crossing. EasingVectors is checked against the scalar curves, and its slerp
+ * for the short way round, opposite ends and the nearly parallel fallback. EasingTweenPool is checked through adds,
+ * swap-and-pop removes and the completed list, and its parallel Update against the serial one bit for bit.
+ * EasingWorkerPool is checked for running every task once, inline on one thread, and for stealing from the back. EasingIntegralTable is checked against a
+ * brute force sum. Cubic-bezier curves are checked against a bisection in double, keyframes against the presets they
+ * are made of. EasingCompose is checked by rebuilding the Out and InOut curves from their In curves. EasingFixedPoint
+ * is checked against the same cases in Q16.16 and Q32.32, and its raw outputs against a hash, so a change in any bit
+ * fails here rather than as a desynced lockstep replay. EasingHalf and EasingBFloat16 are checked over every bit
+ * pattern, and their packed batches against the float kernels. EasingPolynomialStepper and EasingRecurrenceStepper are
+ * checked tick by tick against the curves, and EasingEnvelope sample by sample.
+ *
+ * Self contained on purpose: tests/NativeCpp_test.py builds and runs it, under AddressSanitizer and
+ * UndefinedBehaviorSanitizer where the compiler supports them.
+ *
+ *   g++ -std=c++14 -O1 -fsanitize=address,undefined -Inative_cpp tests/NativeCpp_test.cpp -o NativeCpp_test
+ */
+
+#include "EasingCompose.hpp"
+#include "EasingCurve.hpp"
+#include "EasingCurveTable.hpp"
+#include "EasingEnvelope.hpp"
+#include "EasingFixedPoint.hpp"
+#include "EasingFunctions.hpp"
+#include "EasingFunctionsSimd.hpp"
+#include "EasingIntegralTable.hpp"
+#include "EasingPrecision.hpp"
+#include "EasingStepper.hpp"
+#include "EasingTweenPool.hpp"
+#include "EasingVectors.hpp"
+#include "EasingWorkerPool.hpp"
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    typedef EasingFunctions E;
+    typedef EasingFunctions::EEaseType EEaseType;
+
+    int Failures = 0;
+    int Checks = 0;
+
+    #define EASING_TEST_CHECK_NEAR(actual, expected, tolerance, what) \
+        CheckNear(double(actual), double(expected), double(tolerance), what, __LINE__)
+
+    void CheckNear(double actual, double expected, double tolerance, const char* what, int line)
+    {
+        ++Checks;
+
+        if (!(std::fabs(actual - expected) <= tolerance)) {
+            ++Failures;
+            std::printf("NativeCpp_test.cpp:%d: %s: expected %.9g, got %.9g\n", line, what, expected, actual);
+        }
+    }
+
+    //
+    // double and long double compute in their own precision, except under EASING_FAST_MATH, where they share the float
+    // accurate polynomials.
+    //
+#if defined(EASING_FAST_MATH)
+    const double WideTolerance = 1e-6;
+    const double WideSlopeTolerance = 2e-5;
+#else
+    const double WideTolerance = 1e-12;
+    const double WideSlopeTolerance = 1e-12;
+#endif
+
+    struct EaseCase
+    {
+        EEaseType EaseType;
+        float Alpha;
+        double Expected;
+    };
+
+    const EaseCase EaseCases[] =
+    {
+        { E::EASE_LINEAR, 0.0f, 0.0 }, { E::EASE_LINEAR, 1.0f, 1.0 }, { E::EASE_LINEAR, 0.5f, 0.5 },
+        { E::EASE_SPRING, 0.0f, 0.0 }, { E::EASE_SPRING, 1.0f, 1.0 }, { E::EASE_SPRING, 0.5f, 1.0510158018655051 },
+
+        { E::EASE_IN_QUAD, 0.0f, 0.0 }, { E::EASE_IN_QUAD, 1.0f, 1.0 }, { E::EASE_IN_QUAD, 0.5f, 0.25 },
+        { E::EASE_OUT_QUAD, 0.0f, 0.0 }, { E::EASE_OUT_QUAD, 1.0f, 1.0 }, { E::EASE_OUT_QUAD, 0.5f, 0.75 },
+        { E::EASE_IN_OUT_QUAD, 0.0f, 0.0 }, { E::EASE_IN_OUT_QUAD, 1.0f, 1.0 }, { E::EASE_IN_OUT_QUAD, 0.5f, 0.5 },
+        { E::EASE_IN_OUT_QUAD, 0.25f, 0.125 }, { E::EASE_IN_OUT_QUAD, 0.75f, 0.875 },
+
+        { E::EASE_IN_CUBIC, 0.0f, 0.0 }, { E::EASE_IN_CUBIC, 1.0f, 1.0 }, { E::EASE_IN_CUBIC, 0.5f, 0.125 },
+        { E::EASE_OUT_CUBIC, 0.0f, 0.0 }, { E::EASE_OUT_CUBIC, 1.0f, 1.0 }, { E::EASE_OUT_CUBIC, 0.5f, 0.875 },
+        { E::EASE_IN_OUT_CUBIC, 0.0f, 0.0 }, { E::EASE_IN_OUT_CUBIC, 1.0f, 1.0 }, { E::EASE_IN_OUT_CUBIC, 0.5f, 0.5 },
+        { E::EASE_IN_OUT_CUBIC, 0.25f, 0.0625 }, { E::EASE_IN_OUT_CUBIC, 0.75f, 0.9375 },
+
+        { E::EASE_IN_QUART, 0.0f, 0.0 }, { E::EASE_IN_QUART, 1.0f, 1.0 }, { E::EASE_IN_QUART, 0.5f, 0.0625 },
+        { E::EASE_OUT_QUART, 0.0f, 0.0 }, { E::EASE_OUT_QUART, 1.0f, 1.0 }, { E::EASE_OUT_QUART, 0.5f, 0.9375 },
+        { E::EASE_IN_OUT_QUART, 0.0f, 0.0 }, { E::EASE_IN_OUT_QUART, 1.0f, 1.0 }, { E::EASE_IN_OUT_QUART, 0.5f, 0.5 },
+        { E::EASE_IN_OUT_QUART, 0.25f, 0.03125 }, { E::EASE_IN_OUT_QUART, 0.75f, 0.96875 },
+
+        { E::EASE_IN_QUINT, 0.0f, 0.0 }, { E::EASE_IN_QUINT, 1.0f, 1.0 }, { E::EASE_IN_QUINT, 0.5f, 0.03125 },
+        { E::EASE_OUT_QUINT, 0.0f, 0.0 }, { E::EASE_OUT_QUINT, 1.0f, 1.0 }, { E::EASE_OUT_QUINT, 0.5f, 0.96875 },
+        { E::EASE_IN_OUT_QUINT, 0.0f, 0.0 }, { E::EASE_IN_OUT_QUINT, 1.0f, 1.0 }, { E::EASE_IN_OUT_QUINT, 0.5f, 0.5 },
+        { E::EASE_IN_OUT_QUINT, 0.25f, 0.015625 }, { E::EASE_IN_OUT_QUINT, 0.75f, 0.984375 },
+
+        { E::EASE_IN_SINE, 0.0f, 0.0 }, { E::EASE_IN_SINE, 1.0f, 1.0 }, { E::EASE_IN_SINE, 0.5f, 0.2928932188134524 },
+        { E::EASE_OUT_SINE, 0.0f, 0.0 }, { E::EASE_OUT_SINE, 1.0f, 1.0 }, { E::EASE_OUT_SINE, 0.5f, 0.7071067811865476 },
+        { E::EASE_IN_OUT_SINE, 0.0f, 0.0 }, { E::EASE_IN_OUT_SINE, 1.0f, 1.0 }, { E::EASE_IN_OUT_SINE, 0.5f, 0.5 },
+
+        { E::EASE_IN_EXPO, 0.0f, 0.0009765625 }, { E::EASE_IN_EXPO, 1.0f, 1.0 }, { E::EASE_IN_EXPO, 0.5f, 0.03125 },
+        { E::EASE_OUT_EXPO, 0.0f, 0.0 }, { E::EASE_OUT_EXPO, 1.0f, 0.9990234375 }, { E::EASE_OUT_EXPO, 0.5f, 0.96875 },
+        { E::EASE_IN_OUT_EXPO, 0.0f, 0.00048828125 }, { E::EASE_IN_OUT_EXPO, 1.0f, 0.99951171875 }, { E::EASE_IN_OUT_EXPO, 0.5f, 0.5 },
+
+        { E::EASE_IN_CIRC, 0.0f, 0.0 }, { E::EASE_IN_CIRC, 1.0f, 1.0 }, { E::EASE_IN_CIRC, 0.5f, 0.1339745962155614 },
+        { E::EASE_OUT_CIRC, 0.0f, 0.0 }, { E::EASE_OUT_CIRC, 1.0f, 1.0 }, { E::EASE_OUT_CIRC, 0.5f, 0.8660254037844386 },
+        { E::EASE_IN_OUT_CIRC, 0.0f, 0.0 }, { E::EASE_IN_OUT_CIRC, 1.0f, 1.0 }, { E::EASE_IN_OUT_CIRC, 0.5f, 0.5 },
+
+        { E::EASE_IN_BOUNCE, 0.0f, 0.0 }, { E::EASE_IN_BOUNCE, 1.0f, 1.0 }, { E::EASE_IN_BOUNCE, 0.5f, 0.234375 },
+        { E::EASE_OUT_BOUNCE, 0.0f, 0.0 }, { E::EASE_OUT_BOUNCE, 1.0f, 1.0 }, { E::EASE_OUT_BOUNCE, 0.5f, 0.765625 },
+        { E::EASE_IN_OUT_BOUNCE, 0.0f, 0.0 }, { E::EASE_IN_OUT_BOUNCE, 1.0f, 1.0 }, { E::EASE_IN_OUT_BOUNCE, 0.5f, 0.5 },
+        { E::EASE_OUT_BOUNCE, 0.25f, 0.47265625 }, { E::EASE_OUT_BOUNCE, 0.75f, 0.97265625 },
+
+        { E::EASE_IN_BACK, 0.0f, 0.0 }, { E::EASE_IN_BACK, 1.0f, 1.0 }, { E::EASE_IN_BACK, 0.5f, -0.08769750000000004 },
+        { E::EASE_OUT_BACK, 0.0f, 0.0 }, { E::EASE_OUT_BACK, 1.0f, 1.0 }, { E::EASE_OUT_BACK, 0.5f, 1.0876975 },
+        { E::EASE_IN_OUT_BACK, 0.0f, 0.0 }, { E::EASE_IN_OUT_BACK, 1.0f, 1.0 }, { E::EASE_IN_OUT_BACK, 0.5f, 0.5 },
+
+        { E::EASE_IN_ELASTIC, 0.0f, 0.0 }, { E::EASE_IN_ELASTIC, 1.0f, 1.0 }, { E::EASE_IN_ELASTIC, 0.5f, -0.015625 },
+        { E::EASE_OUT_ELASTIC, 0.0f, 0.0 }, { E::EASE_OUT_ELASTIC, 1.0f, 1.0 }, { E::EASE_OUT_ELASTIC, 0.5f, 1.015625 },
+        { E::EASE_IN_OUT_ELASTIC, 0.0f, 0.0 }, { E::EASE_IN_OUT_ELASTIC, 1.0f, 1.0 }, { E::EASE_IN_OUT_ELASTIC, 0.5f, 0.5 }
+    };
+
+    //
+    // Slopes worked out by hand from each formula, per normalized alpha.
+    //
+    const EaseCase DerivativeCases[] =
+    {
+        { E::EASE_LINEAR, 0.5f, 1.0 },
+        { E::EASE_IN_QUAD, 0.5f, 1.0 }, { E::EASE_OUT_QUAD, 0.25f, 1.5 }, { E::EASE_IN_OUT_QUAD, 0.25f, 1.0 },
+        { E::EASE_IN_OUT_QUAD, 0.5f, 2.0 },
+        { E::EASE_IN_CUBIC, 0.5f, 0.75 }, { E::EASE_OUT_CUBIC, 0.5f, 0.75 }, { E::EASE_IN_OUT_CUBIC, 0.25f, 0.75 },
+        { E::EASE_IN_OUT_CUBIC, 0.5f, 3.0 },
+        { E::EASE_IN_QUART, 0.5f, 0.5 }, { E::EASE_OUT_QUART, 0.5f, 0.5 }, { E::EASE_IN_OUT_QUART, 0.75f, 0.5 },
+        { E::EASE_IN_QUINT, 0.5f, 0.3125 }, { E::EASE_OUT_QUINT, 0.5f, 0.3125 }, { E::EASE_IN_OUT_QUINT, 0.25f, 0.3125 },
+        { E::EASE_IN_SINE, 1.0f, 1.5707963267948966 }, { E::EASE_OUT_SINE, 0.0f, 1.5707963267948966 },
+        { E::EASE_IN_OUT_SINE, 0.5f, 1.5707963267948966 },
+        { E::EASE_IN_EXPO, 1.0f, 6.931471805599453 }, { E::EASE_OUT_EXPO, 0.0f, 6.931471805599453 },
+        { E::EASE_IN_OUT_EXPO, 0.5f, 6.931471805599453 },
+        { E::EASE_IN_CIRC, 0.5f, 0.5773502691896258 }, { E::EASE_OUT_CIRC, 0.5f, 0.5773502691896258 },
+        { E::EASE_IN_OUT_CIRC, 0.25f, 0.5773502691896258 },
+        { E::EASE_OUT_BOUNCE, 0.25f, 3.78125 }, { E::EASE_IN_BOUNCE, 0.75f, 3.78125 }, { E::EASE_IN_OUT_BOUNCE, 0.5f, 0.0 },
+        { E::EASE_IN_BACK, 1.0f, 4.70158 }, { E::EASE_OUT_BACK, 0.0f, 4.70158 }, { E::EASE_IN_OUT_BACK, 0.5f, 5.5949095 },
+        { E::EASE_IN_ELASTIC, 1.0f, 6.931471805599453 }, { E::EASE_OUT_ELASTIC, 0.0f, 6.931471805599453 },
+        { E::EASE_IN_OUT_ELASTIC, 0.5f, 6.931471805599453 },
+        { E::EASE_SPRING, 1.0f, -0.2 }
+    };
+
+    void TestEases()
+    {
+        for (const EaseCase& test : EaseCases) {
+            const float start = 0.0f;
+            const float end = 1.0f;
+            float batch = 0.0f;
+            float simd = 0.0f;
+
+            E::GetEaseFromTypeBatch(test.EaseType, &start, &end, &test.Alpha, &batch, 1);
+            EasingFunctionsSimd::GetEaseFromTypeBatch(test.EaseType, &start, &end, &test.Alpha, &simd, 1);
+
+            EASING_TEST_CHECK_NEAR(E::GetEaseFromType(test.EaseType, 0.0f, 1.0f, test.Alpha), test.Expected, 1e-6, "GetEaseFromType<float>");
+            EASING_TEST_CHECK_NEAR(E::GetEaseFromType(test.EaseType, 0.0, 1.0, double(test.Alpha)), test.Expected, WideTolerance, "GetEaseFromType<double>");
+            EASING_TEST_CHECK_NEAR(E::GetEaseFromType(test.EaseType, 0.0L, 1.0L, (long double)test.Alpha), test.Expected, WideTolerance, "GetEaseFromType<long double>");
+            EASING_TEST_CHECK_NEAR(E::GetEasingFunction(test.EaseType)(0.0f, 1.0f, test.Alpha), test.Expected, 1e-6, "GetEasingFunction");
+            EASING_TEST_CHECK_NEAR(batch, test.Expected, 1e-6, "GetEaseFromTypeBatch");
+            EASING_TEST_CHECK_NEAR(simd, test.Expected, 1e-5, "EasingFunctionsSimd::GetEaseFromTypeBatch");
+            EASING_TEST_CHECK_NEAR(E::GetEaseWithVelocityFromType(test.EaseType, 0.0f, 1.0f, test.Alpha).Value, test.Expected, 1e-6, "GetEaseWithVelocityFromType");
+
+            // Every curve is start + (end - start) * weight, so a shifted and scaled range must agree.
+            EASING_TEST_CHECK_NEAR(E::GetEaseFromType(test.EaseType, -2.0f, 6.0f, test.Alpha), -2.0 + 8.0 * test.Expected, 1e-5, "GetEaseFromType scaled");
+        }
+
+        // The compile time path, spot checked for one curve per family.
+        EASING_TEST_CHECK_NEAR(E::Ease<E::EASE_SPRING>(0.0f, 1.0f, 0.5f), 1.0510158018655051, 1e-6, "Ease<EASE_SPRING>");
+        EASING_TEST_CHECK_NEAR(E::Ease<E::EASE_IN_OUT_QUINT>(0.0f, 1.0f, 0.75f), 0.984375, 1e-6, "Ease<EASE_IN_OUT_QUINT>");
+        EASING_TEST_CHECK_NEAR(E::Ease<E::EASE_OUT_SINE>(0.0, 1.0, 0.5), 0.7071067811865476, 1e-6, "Ease<EASE_OUT_SINE>");
+        EASING_TEST_CHECK_NEAR(E::Ease<E::EASE_OUT_BOUNCE>(0.0f, 1.0f, 0.5f), 0.765625, 1e-6, "Ease<EASE_OUT_BOUNCE>");
+        EASING_TEST_CHECK_NEAR(E::Ease<E::EASE_OUT_ELASTIC>(0.0f, 1.0f, 0.5f), 1.015625, 1e-6, "Ease<EASE_OUT_ELASTIC>");
+
+        // Mixed argument types still go through the float overloads of the curves that used to take floats.
+        EASING_TEST_CHECK_NEAR(E::EaseInSine(0, 10, 0.5f), 10.0 - 10.0 * 0.7071067811865476, 1e-5, "EaseInSine(int, int, float)");
+        EASING_TEST_CHECK_NEAR(E::EaseInOutQuart(0, 10, 0.5f), 5.0, 1e-5, "EaseInOutQuart(int, int, float)");
+        EASING_TEST_CHECK_NEAR(E::EaseOutElastic(0.0f, 1.0f, 1), 1.0, 1e-6, "EaseOutElastic(float, float, int)");
+        EASING_TEST_CHECK_NEAR(E::EaseInOutQuadD(0, 1, 0.25f), 1.0, 1e-6, "EaseInOutQuadD(int, int, float)");
+
+        EASING_TEST_CHECK_NEAR(E::GetEasingFunction(EEaseType(E::EASE_TYPE_COUNT)) == nullptr, 1, 0, "GetEasingFunction out of range");
+        EASING_TEST_CHECK_NEAR(E::GetEaseFromType(EEaseType(E::EASE_TYPE_COUNT), 0.0f, 1.0f, 0.5f), 0.0, 0.0, "GetEaseFromType out of range");
+    }
+
+    //
+    // True within `window` of a join between two Bounce segments, where the slope jumps. OutBounce joins at 1, 2 and
+    // 2.5 over 2.75; InBounce mirrors it, and InOutBounce squeezes each into one half.
+    //
+    bool IsNearBounceKink(EEaseType easeType, double alpha, double window)
+    {
+        const double joins[] = { 1.0 / 2.75, 2.0 / 2.75, 2.5 / 2.75 };
+        bool near = false;
+
+        for (double join : joins) {
+            switch (easeType)
+            {
+                default:
+                    break;
+
+                case E::EASE_OUT_BOUNCE:
+                    near = near || std::fabs(alpha - join) < window;
+                    break;
+
+                case E::EASE_IN_BOUNCE:
+                    near = near || std::fabs(alpha - (1.0 - join)) < window;
+                    break;
+
+                case E::EASE_IN_OUT_BOUNCE:
+                    near = near || std::fabs(alpha - 0.5 * (1.0 - join)) < window || std::fabs(alpha - 0.5 * (1.0 + join)) < window;
+                    break;
+            }
+        }
+
+        return near;
+    }
+
+    void TestDerivatives()
+    {
+        for (const EaseCase& test : DerivativeCases) {
+            EASING_TEST_CHECK_NEAR(E::GetEaseDerivativeFromType(test.EaseType, 0.0f, 1.0f, test.Alpha), test.Expected, 2e-5, "GetEaseDerivativeFromType<float>");
+            EASING_TEST_CHECK_NEAR(E::GetEaseDerivativeFromType(test.EaseType, 0.0, 1.0, double(test.Alpha)), test.Expected, WideSlopeTolerance, "GetEaseDerivativeFromType<double>");
+            EASING_TEST_CHECK_NEAR(E::GetEaseDerivativeFromType(test.EaseType, 0.0L, 1.0L, (long double)test.Alpha), test.Expected, WideSlopeTolerance, "GetEaseDerivativeFromType<long double>");
+            EASING_TEST_CHECK_NEAR(E::GetEasingFunctionDerivative(test.EaseType)(0.0f, 1.0f, test.Alpha), test.Expected, 2e-5, "GetEasingFunctionDerivative");
+            EASING_TEST_CHECK_NEAR(E::GetEaseWithVelocityFromType(test.EaseType, 0.0f, 1.0f, test.Alpha).Velocity, test.Expected, 2e-5, "GetEaseWithVelocityFromType velocity");
+        }
+
+        // Every derivative against a central difference of its curve, away from the Bounce kinks and the Circ ends.
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+
+            for (int i = 1; i < 64; ++i) {
+                const double alpha = (i + 0.37) / 65.0;
+                const double h = 1e-4;
+
+                const bool nearVertical = type >= E::EASE_IN_CIRC && type <= E::EASE_IN_OUT_CIRC && (alpha < 0.05 || alpha > 0.95 || std::fabs(alpha - 0.5) < 0.05);
+
+                // A difference straddling a kink would average the slopes on its two sides.
+                if (nearVertical || IsNearBounceKink(easeType, alpha, 2.0 * h)) {
+                    continue;
+                }
+
+                const double slope = (E::GetEaseFromType(easeType, 0.0, 1.0, alpha + h) - E::GetEaseFromType(easeType, 0.0, 1.0, alpha - h)) / (2.0 * h);
+                const double derivative = E::GetEaseDerivativeFromType(easeType, 0.0, 1.0, alpha);
+
+                EASING_TEST_CHECK_NEAR(derivative, slope, 0.01 * (1.0 + std::fabs(slope)), "derivative vs central difference");
+            }
+        }
+    }
+
+    struct TestVector
+    {
+        float x;
+        float y;
+        float z;
+
+        TestVector operator+(const TestVector& other) const { return { x + other.x, y + other.y, z + other.z }; }
+        TestVector operator-(const TestVector& other) const { return { x - other.x, y - other.y, z - other.z }; }
+        TestVector operator*(float weight) const { return { x * weight, y * weight, z * weight }; }
+    };
+
+    struct TestQuaternion
+    {
+        double x;
+        double y;
+        double z;
+        double w;
+    };
+
+    //
+    // Rotation by `angle` about the unit axis (x, y, z).
+    //
+    TestQuaternion AxisAngle(double x, double y, double z, double angle)
+    {
+        const double s = std::sin(0.5 * angle);
+        return { x * s, y * s, z * s, std::cos(0.5 * angle) };
+    }
+
+    void CheckQuaternion(const TestQuaternion& actual, const TestQuaternion& expected, double tolerance, const char* what)
+    {
+        EASING_TEST_CHECK_NEAR(actual.x, expected.x, tolerance, what);
+        EASING_TEST_CHECK_NEAR(actual.y, expected.y, tolerance, what);
+        EASING_TEST_CHECK_NEAR(actual.z, expected.z, tolerance, what);
+        EASING_TEST_CHECK_NEAR(actual.w, expected.w, tolerance, what);
+        EASING_TEST_CHECK_NEAR(actual.x * actual.x + actual.y * actual.y + actual.z * actual.z + actual.w * actual.w, 1.0, 1e-12, what);
+    }
+
+    void TestVectors()
+    {
+        const TestVector from = { 1.0f, -2.0f, 4.0f };
+        const TestVector to = { -3.0f, 6.0f, 0.5f };
+        const float weight = E::EaseOutBack(0.0f, 1.0f, 0.3f);
+        const TestVector eased = EasingVectors::Ease(E::EASE_OUT_BACK, from, to, 0.3f);
+        const TestVector compiled = EasingVectors::Ease<E::EASE_OUT_BACK>(from, to, 0.3f);
+
+        EASING_TEST_CHECK_NEAR(eased.y, -2.0f + 8.0f * weight, 1e-6, "EasingVectors::Ease");
+        EASING_TEST_CHECK_NEAR(compiled.z, 4.0f - 3.5f * weight, 1e-6, "EasingVectors::Ease<E>");
+
+        // 600 values cross the 256 element blocks of EaseBatch twice and end on a partial one; then again in place.
+        const std::size_t count = 600;
+        static TestVector starts[count];
+        static TestVector ends[count];
+        static TestVector out[count];
+        static float alphas[count];
+
+        for (std::size_t i = 0; i < count; ++i) {
+            starts[i] = { float(i), -float(i) * 0.5f, 1.0f };
+            ends[i] = { float(i) + 2.0f, float(i), -1.0f };
+            alphas[i] = float(i % 97) / 96.0f;
+        }
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+            double worst = 0.0;
+
+            EasingVectors::EaseBatch(easeType, starts, ends, alphas, out, count);
+
+            // Relative to the size of the values, which reach 600.
+            for (std::size_t i = 0; i < count; ++i) {
+                const TestVector expected = EasingVectors::Ease(easeType, starts[i], ends[i], alphas[i]);
+                worst = std::fmax(worst, std::fabs(out[i].x - expected.x) / (1.0 + std::fabs(expected.x)));
+                worst = std::fmax(worst, std::fabs(out[i].y - expected.y) / (1.0 + std::fabs(expected.y)));
+                worst = std::fmax(worst, std::fabs(out[i].z - expected.z) / (1.0 + std::fabs(expected.z)));
+            }
+
+            EASING_TEST_CHECK_NEAR(worst, 0.0, 1e-6, "EasingVectors::EaseBatch vs Ease");
+        }
+
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = starts[i];
+        }
+
+        EasingVectors::EaseBatch(E::EASE_IN_OUT_CUBIC, out, ends, alphas, out, count);
+        EASING_TEST_CHECK_NEAR(out[count - 1].x, EasingVectors::Ease(E::EASE_IN_OUT_CUBIC, starts[count - 1], ends[count - 1], alphas[count - 1]).x, 1e-4, "EasingVectors::EaseBatch in place");
+
+        // A quarter of the way along a quarter turn, by weight (InQuad at 0.5) and by the compile time path.
+        const TestQuaternion identity = { 0.0, 0.0, 0.0, 1.0 };
+        const TestQuaternion quarter = AxisAngle(0.0, 1.0, 0.0, 0.5 * E::Pi);
+
+        CheckQuaternion(EasingVectors::EaseQuaternion(E::EASE_IN_QUAD, identity, quarter, 0.5), AxisAngle(0.0, 1.0, 0.0, 0.125 * E::Pi), 1e-12, "EaseQuaternion");
+        CheckQuaternion(EasingVectors::EaseQuaternion<E::EASE_LINEAR>(identity, quarter, 0.25), AxisAngle(0.0, 1.0, 0.0, 0.125 * E::Pi), 1e-12, "EaseQuaternion<E>");
+
+        // -q is the same rotation as q. Going to the negated quarter turn must take the same short path, not the long
+        // way round through the other 270 degrees; and q to -q must not move at all.
+        const TestQuaternion negated = { -quarter.x, -quarter.y, -quarter.z, -quarter.w };
+        const TestQuaternion opposite = { -identity.x, -identity.y, -identity.z, -identity.w };
+
+        CheckQuaternion(EasingVectors::Slerp(identity, negated, 0.5), AxisAngle(0.0, 1.0, 0.0, 0.25 * E::Pi), 1e-12, "Slerp takes the shortest arc");
+        CheckQuaternion(EasingVectors::Slerp(identity, opposite, 0.5), identity, 0.0, "Slerp between q and -q");
+
+        // Nearly parallel ends take the normalized lerp. Unnormalized, its midpoint would be 1e-4 short of unit length.
+        const TestQuaternion near = AxisAngle(1.0, 0.0, 0.0, 0.06);
+
+        CheckQuaternion(EasingVectors::Slerp(identity, near, 0.5), AxisAngle(1.0, 0.0, 0.0, 0.03), 1e-12, "Slerp nearly parallel");
+        CheckQuaternion(EasingVectors::Slerp(identity, near, 0.25), AxisAngle(1.0, 0.0, 0.0, 0.015), 1e-6, "Slerp nearly parallel, off center");
+    }
+
+    void CheckTween(const EasingTweenPool& pool, EasingTweenPool::TweenId id, EEaseType easeType, float start, float end, float alpha, const char* what)
+    {
+        EASING_TEST_CHECK_NEAR(pool.IsActive(id), 1, 0, what);
+        EASING_TEST_CHECK_NEAR(pool.GetEaseType(id), easeType, 0, what);
+        EASING_TEST_CHECK_NEAR(pool.GetAlpha(id), alpha, 1e-6, what);
+        EASING_TEST_CHECK_NEAR(pool.GetValue(id), E::GetEaseFromType(easeType, start, end, alpha), 1e-5, what);
+    }
+
+    void TestTweenPool()
+    {
+        typedef EasingTweenPool::TweenId TweenId;
+
+        EasingTweenPool pool;
+
+        EASING_TEST_CHECK_NEAR(pool.Add(EEaseType(E::EASE_TYPE_COUNT), 0.0f, 1.0f, 1.0f), EasingTweenPool::InvalidTweenId, 0, "EasingTweenPool rejects an unknown curve");
+
+        // Three tweens share the OutBounce bucket, one has InQuad to itself, and one starts halfway through.
+        const TweenId a = pool.Add(E::EASE_OUT_BOUNCE, 0.0f, 10.0f, 1.0f);
+        const TweenId b = pool.Add(E::EASE_OUT_BOUNCE, 5.0f, -5.0f, 3.0f);
+        const TweenId c = pool.Add(E::EASE_IN_QUAD, 1.0f, 3.0f, 0.5f);
+        const TweenId d = pool.Add(E::EASE_OUT_BOUNCE, -1.0f, 1.0f, 4.0f, 2.0f);
+
+        EASING_TEST_CHECK_NEAR(pool.GetCount(), 4, 0, "EasingTweenPool count");
+        EASING_TEST_CHECK_NEAR(pool.GetBucketCount(E::EASE_OUT_BOUNCE), 3, 0, "EasingTweenPool bucket count");
+        CheckTween(pool, d, E::EASE_OUT_BOUNCE, -1.0f, 1.0f, 0.5f, "EasingTweenPool starts from elapsed");
+
+        // Each bucket goes through its own curve.
+        pool.Update(0.25f);
+
+        CheckTween(pool, a, E::EASE_OUT_BOUNCE, 0.0f, 10.0f, 0.25f, "EasingTweenPool update");
+        CheckTween(pool, b, E::EASE_OUT_BOUNCE, 5.0f, -5.0f, 0.25f / 3.0f, "EasingTweenPool update");
+        CheckTween(pool, c, E::EASE_IN_QUAD, 1.0f, 3.0f, 0.5f, "EasingTweenPool update");
+        CheckTween(pool, d, E::EASE_OUT_BOUNCE, -1.0f, 1.0f, 0.5625f, "EasingTweenPool update");
+        EASING_TEST_CHECK_NEAR(pool.GetCompletedCount(), 0, 0, "EasingTweenPool nothing completed");
+
+        // Removing the first of the bucket moves the last one, d, into its slot; every id still finds its own tween.
+        EASING_TEST_CHECK_NEAR(pool.Remove(a), 1, 0, "EasingTweenPool remove");
+        EASING_TEST_CHECK_NEAR(pool.Remove(a), 0, 0, "EasingTweenPool remove twice");
+        EASING_TEST_CHECK_NEAR(pool.IsActive(a), 0, 0, "EasingTweenPool removed");
+        EASING_TEST_CHECK_NEAR(pool.GetBucketCount(E::EASE_OUT_BOUNCE), 2, 0, "EasingTweenPool bucket after remove");
+        EASING_TEST_CHECK_NEAR(pool.GetBucketIds(E::EASE_OUT_BOUNCE)[0], d, 0, "EasingTweenPool swap-and-pop");
+        EASING_TEST_CHECK_NEAR(pool.GetBucketValues(E::EASE_OUT_BOUNCE)[0], pool.GetValue(d), 0.0, "EasingTweenPool swap-and-pop");
+
+        CheckTween(pool, b, E::EASE_OUT_BOUNCE, 5.0f, -5.0f, 0.25f / 3.0f, "EasingTweenPool after remove");
+        CheckTween(pool, c, E::EASE_IN_QUAD, 1.0f, 3.0f, 0.5f, "EasingTweenPool after remove");
+        CheckTween(pool, d, E::EASE_OUT_BOUNCE, -1.0f, 1.0f, 0.5625f, "EasingTweenPool after remove");
+
+        // The free id is reused.
+        const TweenId e = pool.Add(E::EASE_LINEAR, 0.0f, 4.0f, 1.0f);
+        EASING_TEST_CHECK_NEAR(e, a, 0, "EasingTweenPool reuses ids");
+
+        // Each tween is reported once, by the Update that takes it to its duration: c first, then e and d together, then b.
+        pool.Update(0.5f);
+        EASING_TEST_CHECK_NEAR(pool.GetCompletedCount(), 1, 0, "EasingTweenPool completed count");
+        EASING_TEST_CHECK_NEAR(pool.GetCompleted()[0], c, 0, "EasingTweenPool completed");
+        CheckTween(pool, c, E::EASE_IN_QUAD, 1.0f, 3.0f, 1.0f, "EasingTweenPool holds the end value");
+
+        pool.Update(1.25f);
+        EASING_TEST_CHECK_NEAR(pool.GetCompletedCount(), 2, 0, "EasingTweenPool completed count");
+        EASING_TEST_CHECK_NEAR(pool.GetCompleted()[0], e, 0, "EasingTweenPool completed in bucket order");
+        EASING_TEST_CHECK_NEAR(pool.GetCompleted()[1], d, 0, "EasingTweenPool completed in bucket order");
+
+        pool.RemoveCompleted();
+        EASING_TEST_CHECK_NEAR(pool.GetCount(), 2, 0, "EasingTweenPool count after RemoveCompleted");
+        EASING_TEST_CHECK_NEAR(pool.IsActive(d) || pool.IsActive(e), 0, 0, "EasingTweenPool RemoveCompleted");
+        CheckTween(pool, b, E::EASE_OUT_BOUNCE, 5.0f, -5.0f, 2.0f / 3.0f, "EasingTweenPool after RemoveCompleted");
+
+        pool.Update(1.0f);
+        EASING_TEST_CHECK_NEAR(pool.GetCompletedCount(), 1, 0, "EasingTweenPool completed count");
+        EASING_TEST_CHECK_NEAR(pool.GetCompleted()[0], b, 0, "EasingTweenPool completed");
+
+        pool.Update(1.0f);
+        EASING_TEST_CHECK_NEAR(pool.GetCompletedCount(), 0, 0, "EasingTweenPool finished tweens are not reported again");
+        CheckTween(pool, b, E::EASE_OUT_BOUNCE, 5.0f, -5.0f, 1.0f, "EasingTweenPool holds the end value");
+
+        pool.Clear();
+        EASING_TEST_CHECK_NEAR(pool.GetCount(), 0, 0, "EasingTweenPool clear");
+        EASING_TEST_CHECK_NEAR(pool.IsActive(b) || pool.IsActive(c), 0, 0, "EasingTweenPool clear");
+
+        // Tweens added already finished are reported by the next Update, once, like any other.
+        const TweenId zero = pool.Add(E::EASE_LINEAR, 0.0f, 1.0f, 0.0f);
+        const TweenId elapsed = pool.Add(E::EASE_IN_QUAD, 0.0f, 1.0f, 1.0f, 2.0f);
+        const TweenId running = pool.Add(E::EASE_LINEAR, 0.0f, 1.0f, 1.0f);
+        CheckTween(pool, zero, E::EASE_LINEAR, 0.0f, 1.0f, 1.0f, "EasingTweenPool zero duration");
+        CheckTween(pool, elapsed, E::EASE_IN_QUAD, 0.0f, 1.0f, 1.0f, "EasingTweenPool added past its duration");
+
+        pool.Update(0.25f);
+        EASING_TEST_CHECK_NEAR(pool.GetCompletedCount(), 2, 0, "EasingTweenPool reports tweens added finished");
+        EASING_TEST_CHECK_NEAR(pool.GetCompleted()[0], zero, 0, "EasingTweenPool reports tweens added finished");
+        EASING_TEST_CHECK_NEAR(pool.GetCompleted()[1], elapsed, 0, "EasingTweenPool reports tweens added finished");
+
+        pool.RemoveCompleted();
+        EASING_TEST_CHECK_NEAR(pool.GetCount(), 1, 0, "EasingTweenPool removes tweens added finished");
+        EASING_TEST_CHECK_NEAR(pool.IsActive(running), 1, 0, "EasingTweenPool removes tweens added finished");
+
+        pool.Update(0.25f);
+        EASING_TEST_CHECK_NEAR(pool.GetCompletedCount(), 0, 0, "EasingTweenPool reports tweens added finished once");
+    }
+
+    //
+    // Runs `taskCount` tasks and checks that each one ran exactly once and had finished by the time ParallelFor returned.
+    //
+    void CheckParallelFor(EasingWorkerPool& workers, std::size_t taskCount, const char* what)
+    {
+        std::vector<std::atomic<int>> runs(taskCount);
+
+        for (std::size_t task = 0; task < taskCount; ++task) {
+            runs[task].store(0);
+        }
+
+        workers.ParallelFor(taskCount, [&runs](std::size_t task) { runs[task].fetch_add(1); });
+
+        int wrong = 0;
+
+        for (std::size_t task = 0; task < taskCount; ++task) {
+            wrong += runs[task].load() != 1 ? 1 : 0;
+        }
+
+        EASING_TEST_CHECK_NEAR(wrong, 0, 0, what);
+    }
+
+    void TestWorkerPool()
+    {
+        EasingWorkerPool automatic;
+        EASING_TEST_CHECK_NEAR(automatic.GetThreadCount() >= 1, 1, 0, "EasingWorkerPool(0) uses the hardware threads");
+        CheckParallelFor(automatic, 1000, "EasingWorkerPool(0) runs every task once");
+
+        // One thread runs everything inline, in order, on the calling thread; no tasks is no call at all.
+        EasingWorkerPool single(1);
+        std::vector<std::size_t> order;
+        bool onCaller = true;
+        const std::thread::id caller = std::this_thread::get_id();
+
+        single.ParallelFor(5, [&](std::size_t task) {
+            order.push_back(task);
+            onCaller = onCaller && std::this_thread::get_id() == caller;
+        });
+
+        EASING_TEST_CHECK_NEAR(order.size(), 5, 0, "EasingWorkerPool(1) runs every task");
+        EASING_TEST_CHECK_NEAR(order.size() == 5 && order[0] == 0 && order[4] == 4, 1, 0, "EasingWorkerPool(1) runs in order");
+        EASING_TEST_CHECK_NEAR(onCaller, 1, 0, "EasingWorkerPool(1) runs on the calling thread");
+
+        single.ParallelFor(0, [&](std::size_t) { order.push_back(0); });
+        EASING_TEST_CHECK_NEAR(order.size(), 5, 0, "EasingWorkerPool with no tasks");
+
+        // Fork-join over and over, with fewer, as many and more tasks than threads.
+        EasingWorkerPool workers(4);
+        const std::size_t taskCounts[] = { 0, 1, 3, 4, 7, 1000 };
+
+        for (int round = 0; round < 50; ++round) {
+            for (std::size_t taskCount : taskCounts) {
+                CheckParallelFor(workers, taskCount, "EasingWorkerPool(4) runs every task once");
+            }
+        }
+
+        // Two threads: the caller owns tasks [0, 8) and the worker [8, 16). The worker's first task waits for all the
+        // others, so the caller has to steal the rest of the worker's range, from the back. Whichever thread runs task 8
+        // runs it last.
+        EasingWorkerPool pair(2);
+        const std::size_t taskCount = 16;
+        std::atomic<std::size_t> finished(0);
+        std::vector<std::size_t> callerOrder;
+
+        pair.ParallelFor(taskCount, [&](std::size_t task) {
+            if (task == taskCount / 2) {
+                while (finished.load() < taskCount - 1) {
+                    std::this_thread::yield();
+                }
+            }
+
+            if (std::this_thread::get_id() == caller) {
+                callerOrder.push_back(task);
+            }
+
+            finished.fetch_add(1);
+        });
+
+        std::vector<std::size_t> expected;
+
+        for (std::size_t task = 0; task < taskCount / 2; ++task) {
+            expected.push_back(task);
+        }
+
+        for (std::size_t task = taskCount - 1; task > taskCount / 2; --task) {
+            expected.push_back(task);
+        }
+
+        if (callerOrder.size() == taskCount) {
+            expected.push_back(taskCount / 2);
+        }
+
+        EASING_TEST_CHECK_NEAR(callerOrder == expected, 1, 0, "EasingWorkerPool steals from the back");
+        EASING_TEST_CHECK_NEAR(finished.load(), taskCount, 0, "EasingWorkerPool joins");
+    }
+
+    //
+    // The same tweens in two pools, one updated serially and one on workers; values and completed lists must match bit
+    // for bit after every step.
+    //
+    void CheckParallelTweenPool(EasingWorkerPool& workers, std::size_t chunkSize, const char* what)
+    {
+        EasingTweenPool serial;
+        EasingTweenPool parallel;
+
+        for (int i = 0; i < 6000; ++i) {
+            const EEaseType easeType = EEaseType((i * 7) % E::EASE_TYPE_COUNT);
+            const float duration = (i % 13 == 0) ? 0.0f : 0.05f + float(i % 29) * 0.1f;
+            const float start = float(i % 11) - 5.0f;
+            const float end = float(i % 17);
+
+            serial.Add(easeType, start, end, duration, float(i % 5) * 0.01f);
+            parallel.Add(easeType, start, end, duration, float(i % 5) * 0.01f);
+        }
+
+        // Shuffle the buckets a little with swap-and-pop.
+        for (EasingTweenPool::TweenId id = 0; id < 6000; id += 37) {
+            serial.Remove(id);
+            parallel.Remove(id);
+        }
+
+        int mismatches = 0;
+
+        // Long enough for every tween to finish, so the pools must end up empty.
+        for (int step = 0; step < 50; ++step) {
+            serial.Update(1.0f / 15.0f);
+            parallel.Update(1.0f / 15.0f, workers, chunkSize);
+
+            mismatches += serial.GetCompletedCount() != parallel.GetCompletedCount() ? 1 : 0;
+            mismatches += std::memcmp(serial.GetCompleted(), parallel.GetCompleted(), serial.GetCompletedCount() * sizeof(EasingTweenPool::TweenId)) != 0 ? 1 : 0;
+
+            for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+                const EEaseType easeType = EEaseType(type);
+                const std::size_t count = serial.GetBucketCount(easeType);
+
+                mismatches += count != parallel.GetBucketCount(easeType) ? 1 : 0;
+                mismatches += std::memcmp(serial.GetBucketValues(easeType), parallel.GetBucketValues(easeType), count * sizeof(float)) != 0 ? 1 : 0;
+            }
+
+            serial.RemoveCompleted();
+            parallel.RemoveCompleted();
+        }
+
+        EASING_TEST_CHECK_NEAR(mismatches, 0, 0, what);
+        EASING_TEST_CHECK_NEAR(serial.GetCount(), 0, 0, what);
+        EASING_TEST_CHECK_NEAR(parallel.GetCount(), 0, 0, what);
+    }
+
+    void TestParallelTweenPool()
+    {
+        EasingWorkerPool single(1);
+        EasingWorkerPool workers(3);
+
+        CheckParallelTweenPool(single, 4096, "EasingTweenPool parallel Update on one thread");
+        CheckParallelTweenPool(workers, 1, "EasingTweenPool parallel Update, one line chunks");
+        CheckParallelTweenPool(workers, 100, "EasingTweenPool parallel Update, 100 tween chunks");
+        CheckParallelTweenPool(workers, 4096, "EasingTweenPool parallel Update, default chunks");
+    }
+
+    template<typename T>
+    void TestInverse()
+    {
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+
+            for (int i = 0; i <= 200; ++i) {
+                const T alpha = T(i) / T(200.0f);
+                const T value = E::GetEaseFromType(easeType, T(-2.0f), T(6.0f), alpha);
+                const T inverse = E::GetEaseInverseFromType(easeType, T(-2.0f), T(6.0f), value);
+
+                // The inverse must land on the same value, to float rounding of the curves times their slope (up to ~7 for
+                // Expo and Elastic) over the range of 8, and no later than alpha since it is the first crossing. Where the
+                // curve is nearly flat, one float step of the value spans more alpha than that, so skip those.
+                EASING_TEST_CHECK_NEAR(E::GetEaseFromType(easeType, T(-2.0f), T(6.0f), inverse), value, 3e-5, "inverse round trip");
+
+                const T unitValue = E::GetEaseFromType(easeType, T(0.0f), T(1.0f), alpha);
+
+                if (std::fabs(E::GetEaseDerivativeFromType(easeType, T(0.0f), T(1.0f), alpha)) > T(0.01f)) {
+                    EASING_TEST_CHECK_NEAR(E::GetEaseInverseFromType(easeType, T(0.0f), T(1.0f), unitValue) <= alpha + T(1e-4f), 1, 0, "inverse is the first crossing");
+                }
+            }
+        }
+
+        // First crossings of the non-monotonic curves and values out of reach.
+        EASING_TEST_CHECK_NEAR(E::GetEaseInverseFromType(E::EASE_OUT_BACK, 0.0f, 1.0f, 1.0f), 1.0 / 2.70158, 1e-5, "OutBack first reaches 1 before overshooting");
+        EASING_TEST_CHECK_NEAR(E::GetEaseInverseFromType(E::EASE_IN_BOUNCE, 0.0f, 1.0f, 0.015625f), 0.0455, 1e-3, "InBounce first hop");
+        EASING_TEST_CHECK_NEAR(E::GetEaseInverseFromType(E::EASE_OUT_BOUNCE, 0.0f, 1.0f, 0.9f), 0.3450, 1e-3, "OutBounce first rise");
+        EASING_TEST_CHECK_NEAR(E::GetEaseInverseFromType(E::EASE_IN_QUAD, 0.0f, 1.0f, 2.0f), 1.0, 0.0, "InQuad above its range");
+        EASING_TEST_CHECK_NEAR(E::GetEaseInverseFromType(E::EASE_IN_EXPO, 0.0f, 1.0f, 0.0f), 0.0, 0.0, "InExpo below its range");
+        EASING_TEST_CHECK_NEAR(E::GetEaseInverseFromType(E::EASE_LINEAR, 3.0f, 3.0f, 3.0f), 0.0, 0.0, "empty range");
+        EASING_TEST_CHECK_NEAR(E::EaseInverse<E::EASE_IN_OUT_CUBIC>(10.0f, 0.0f, 5.0f), 0.5, 1e-6, "EaseInverse<E> on a falling range");
+    }
+
+    //
+    // Brute force integral of the ease and of |ease'| over [from, to], in double at 2^16 steps.
+    //
+    void BruteForceIntegrals(EEaseType easeType, double from, double to, double& area, double& distance)
+    {
+        const int steps = 1 << 16;
+        const double step = (to - from) / steps;
+
+        double previous = E::GetEaseFromType(easeType, 0.0, 1.0, from);
+        area = 0.0;
+        distance = 0.0;
+
+        for (int i = 1; i <= steps; ++i) {
+            const double value = E::GetEaseFromType(easeType, 0.0, 1.0, from + step * i);
+
+            area += E::GetEaseFromType(easeType, 0.0, 1.0, from + step * (i - 0.5)) * step;
+            distance += std::fabs(value - previous);
+            previous = value;
+        }
+    }
+
+    void TestIntegrals()
+    {
+        // Static: a 1024 table is ~25 KB, more than a sanitizer build likes on the stack, and over-aligned for a C++14 new.
+        static EasingIntegralTable<1024> integrals;
+        EasingIntegralTable<1024>* const table = &integrals;
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+            table->Bake(easeType);
+
+            // Distance is exact at table points and carries the Hermite error of the curve table in between. The brute
+            // force sum is what limits the tolerance: it steps over the tip of each Bounce kink, up to 2e-5 short.
+            const double curveError = table->GetCurveTable().MeasureMaxError();
+            double area = 0.0;
+            double distance = 0.0;
+
+            BruteForceIntegrals(easeType, 0.25, 0.75, area, distance);
+            EASING_TEST_CHECK_NEAR(table->Distance(0.0f, 1.0f, 0.25f, 0.75f), distance, 5e-5, "distance between table points");
+            EASING_TEST_CHECK_NEAR(table->Integral(0.0f, 1.0f, 0.25f, 0.75f), area, 5e-6, "integral between table points");
+
+            BruteForceIntegrals(easeType, 0.13, 0.87, area, distance);
+            EASING_TEST_CHECK_NEAR(table->Distance(-2.0f, 6.0f, 0.87f, 0.13f), 8.0 * distance, 8.0 * (5e-5 + 2.0 * curveError), "distance, reversed and scaled");
+            EASING_TEST_CHECK_NEAR(table->AverageSpeed(0.0f, 1.0f, 0.13f, 0.87f), distance / 0.74, (5e-5 + 2.0 * curveError) / 0.74, "average speed");
+            EASING_TEST_CHECK_NEAR(table->Integral(-2.0f, 6.0f, 0.13f, 0.87f), -2.0 * 0.74 + 8.0 * area, 8.0 * 5e-6, "integral, scaled");
+            EASING_TEST_CHECK_NEAR(table->AverageValue(0.0f, 1.0f, 0.87f, 0.13f), area / 0.74, 5e-6 / 0.74, "average value, reversed");
+
+            // Net displacement over the average velocity, and the speed at a point for an empty interval.
+            const double displacement = E::GetEaseFromType(easeType, 0.0, 1.0, 0.87) - E::GetEaseFromType(easeType, 0.0, 1.0, 0.13);
+            EASING_TEST_CHECK_NEAR(E::GetEaseAverageVelocityFromType(easeType, 0.0, 1.0, 0.13, 0.87), displacement / 0.74, 1e-12, "average velocity");
+            EASING_TEST_CHECK_NEAR(E::GetEaseAverageVelocityFromType(easeType, 0.0f, 1.0f, 0.4f, 0.4f),
+                E::GetEaseDerivativeFromType(easeType, 0.0f, 1.0f, 0.4f), 0.0, "average velocity over an empty interval");
+        }
+
+        // The overshooting curves travel further than they get.
+        table->Bake(E::EASE_OUT_BACK);
+        EASING_TEST_CHECK_NEAR(table->Distance(0.0f, 1.0f, 0.0f, 1.0f), 1.2, 1e-4, "OutBack total distance");
+    }
+
+    //
+    // y at x = alpha on a cubic-bezier, solved by bisection in double straight from the control points.
+    //
+    double ReferenceBezier(double x1, double y1, double x2, double y2, double alpha)
+    {
+        double lo = 0.0;
+        double hi = 1.0;
+
+        for (int i = 0; i < 100; ++i) {
+            const double t = 0.5 * (lo + hi);
+            const double x = 3.0 * (1.0 - t) * (1.0 - t) * t * x1 + 3.0 * (1.0 - t) * t * t * x2 + t * t * t;
+
+            if (x < alpha) {
+                lo = t;
+            } else {
+                hi = t;
+            }
+        }
+
+        const double t = 0.5 * (lo + hi);
+        return 3.0 * (1.0 - t) * (1.0 - t) * t * y1 + 3.0 * (1.0 - t) * t * t * y2 + t * t * t;
+    }
+
+    struct BezierCase
+    {
+        float X1;
+        float Y1;
+        float X2;
+        float Y2;
+        double Tolerance;
+    };
+
+    void TestCurves()
+    {
+        // The CSS keywords, an overshoot, and two that go vertical inside the curve, where the solve falls back to
+        // bisection and a float rounding of x is a large step in y.
+        const BezierCase beziers[] =
+        {
+            { 0.25f, 0.1f, 0.25f, 1.0f, 2e-6 }, { 0.42f, 0.0f, 1.0f, 1.0f, 2e-6 }, { 0.0f, 0.0f, 0.58f, 1.0f, 2e-6 },
+            { 0.42f, 0.0f, 0.58f, 1.0f, 2e-6 }, { 0.34f, 1.56f, 0.64f, 1.0f, 2e-6 }, { 0.0f, 0.0f, 1.0f, 1.0f, 2e-6 },
+            { 1.0f, 0.0f, 0.0f, 1.0f, 1e-2 }, { 0.9f, 0.1f, 0.1f, 0.9f, 1e-3 }
+        };
+
+        float start[100];
+        float end[100];
+        float alphas[100];
+        float batch[100];
+
+        for (const BezierCase& test : beziers) {
+            const EasingCurve curve = EasingCurve::CubicBezier(test.X1, test.Y1, test.X2, test.Y2);
+
+            EASING_TEST_CHECK_NEAR(curve.Evaluate(-2.0f, 6.0f, 0.0f), -2.0, 0.0, "bezier at 0");
+            EASING_TEST_CHECK_NEAR(curve.Evaluate(-2.0f, 6.0f, 1.0f), 6.0, 0.0, "bezier at 1");
+            EASING_TEST_CHECK_NEAR(curve.Evaluate(-2.0f, 6.0f, 1.5f), 6.0, 0.0, "bezier clamped");
+
+            // 100 is not a multiple of the 64 wide blocks of the batch kernel.
+            for (int i = 0; i < 100; ++i) {
+                start[i] = -2.0f;
+                end[i] = 6.0f;
+                alphas[i] = float(i) / 99.0f;
+            }
+
+            curve.EvaluateBatch(start, end, alphas, batch, 100);
+
+            for (int i = 0; i < 100; ++i) {
+                const double expected = ReferenceBezier(test.X1, test.Y1, test.X2, test.Y2, alphas[i]);
+
+                EASING_TEST_CHECK_NEAR(curve.Sample(alphas[i]), expected, test.Tolerance, "bezier vs reference");
+                EASING_TEST_CHECK_NEAR(batch[i], curve.Evaluate(-2.0f, 6.0f, alphas[i]), 8.0 * 1e-6, "bezier batch vs scalar");
+            }
+
+            if (curve.HasVerticalTangent()) {
+                continue;
+            }
+
+            for (int i = 1; i < 16; ++i) {
+                const double alpha = i / 16.0;
+                const double slope = (ReferenceBezier(test.X1, test.Y1, test.X2, test.Y2, alpha + 1e-5)
+                    - ReferenceBezier(test.X1, test.Y1, test.X2, test.Y2, alpha - 1e-5)) / 2e-5;
+
+                EASING_TEST_CHECK_NEAR(curve.SampleDerivative(float(alpha)), slope, 1e-4 * (1.0 + std::fabs(slope)), "bezier derivative");
+                EASING_TEST_CHECK_NEAR(curve.EvaluateWithVelocity(0.0f, 1.0f, float(alpha)).Velocity, curve.SampleDerivative(float(alpha)), 0.0, "bezier velocity");
+            }
+        }
+
+        EASING_TEST_CHECK_NEAR(EasingCubicBezier().Sample(0.3f), 0.3, 1e-6, "default bezier is linear");
+        EASING_TEST_CHECK_NEAR(EasingCubicBezier(0.0f, 1.0f, 0.0f, 1.0f).HasVerticalTangent(), 1, 0, "vertical tangent at 0");
+        EASING_TEST_CHECK_NEAR(EasingCubicBezier(0.25f, 0.1f, 0.25f, 1.0f).HasVerticalTangent(), 0, 0, "no vertical tangent");
+
+        // Presets through EasingCurve are the EasingFunctions values, bit for bit.
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EasingCurve curve = EEaseType(type);
+
+            for (int i = 0; i <= 8; ++i) {
+                const float alpha = float(i) / 8.0f;
+
+                EASING_TEST_CHECK_NEAR(curve.Evaluate(-2.0f, 6.0f, alpha), E::GetEaseFromType(EEaseType(type), -2.0f, 6.0f, alpha), 0.0, "preset curve");
+
+                // Between the eighths, which keeps clear of the infinite slopes of the Circ curves.
+                if (i < 8) {
+                    const float between = alpha + 1.0f / 16.0f;
+                    EASING_TEST_CHECK_NEAR(curve.EvaluateDerivative(-2.0f, 6.0f, between),
+                        E::GetEaseDerivativeFromType(EEaseType(type), -2.0f, 6.0f, between), 0.0, "preset curve derivative");
+                }
+            }
+        }
+
+        // A rise to an overshoot, a settle, and a jump back to 0 held to the end.
+        const EasingCurve keys = EasingCurve::Keyframes({
+            { 0.2f, 0.0f, E::EASE_OUT_QUAD },
+            { 0.6f, 1.2f, E::EASE_IN_OUT_SINE },
+            { 0.8f, 1.0f, E::EASE_LINEAR },
+            { 0.8f, 0.0f, E::EASE_LINEAR } });
+
+        EASING_TEST_CHECK_NEAR(keys.GetKeyframeCount(), 4, 0, "keyframe count");
+        EASING_TEST_CHECK_NEAR(keys.Evaluate(-2.0f, 6.0f, 0.1f), -2.0, 0.0, "held before the first key");
+        EASING_TEST_CHECK_NEAR(keys.Sample(0.6f), 1.2, 1e-6, "value at a key");
+        EASING_TEST_CHECK_NEAR(keys.Sample(0.4f), E::GetEaseFromType(E::EASE_OUT_QUAD, 0.0f, 1.2f, 0.5f), 1e-6, "inside a segment");
+        EASING_TEST_CHECK_NEAR(keys.Sample(0.7999f), 1.0, 1e-5, "end of a segment");
+        EASING_TEST_CHECK_NEAR(keys.Sample(0.8f), 0.0, 0.0, "jump");
+        EASING_TEST_CHECK_NEAR(keys.Sample(1.0f), 0.0, 0.0, "held after the last key");
+        EASING_TEST_CHECK_NEAR(keys.SampleDerivative(0.9f), 0.0, 0.0, "no slope while held");
+        EASING_TEST_CHECK_NEAR(keys.SampleDerivative(0.3), (keys.Sample(0.30001) - keys.Sample(0.29999)) / 2e-5, 1e-5, "keyframe derivative");
+        EASING_TEST_CHECK_NEAR(keys.EvaluateWithVelocity(-2.0f, 6.0f, 0.7f).Velocity, keys.EvaluateDerivative(-2.0f, 6.0f, 0.7f), 1e-5, "keyframe velocity");
+
+        keys.EvaluateBatch(start, end, alphas, batch, 100);
+
+        for (int i = 0; i < 100; ++i) {
+            EASING_TEST_CHECK_NEAR(batch[i], keys.Evaluate(-2.0f, 6.0f, alphas[i]), 0.0, "keyframe batch");
+        }
+
+        // Both tables bake any curve.
+        static EasingCurveTable<256> table(EasingCurve::CubicBezier(0.42f, 0.0f, 0.58f, 1.0f), EASE_TABLE_HERMITE);
+        EASING_TEST_CHECK_NEAR(table.MeasureMaxError(), 0.0, 1e-5, "bezier curve table");
+
+        static EasingIntegralTable<1024> integrals(keys);
+        EASING_TEST_CHECK_NEAR(integrals.Distance(0.0f, 1.0f, 0.0f, 1.0f), 1.2 + 0.2 + 1.0, 1e-4, "keyframe distance");
+    }
+
+    void TestCompose()
+    {
+        typedef EasingCompose C;
+
+        // Fused at compile time, like the hand written curves it replaces.
+        static_assert(C::InOut(C::Ease<E::EASE_IN_QUAD>()).Value(0.25f) == 0.125f, "InOut of InQuad");
+        static_assert(C::Mirror(C::Ease<E::EASE_IN_CUBIC>()).Value(0.5f) == 0.875f, "Mirror of InCubic");
+
+        // The library's Out and InOut curves, rebuilt from their In curves.
+        const EEaseType families[][3] =
+        {
+            { E::EASE_IN_QUAD, E::EASE_OUT_QUAD, E::EASE_IN_OUT_QUAD },
+            { E::EASE_IN_CUBIC, E::EASE_OUT_CUBIC, E::EASE_IN_OUT_CUBIC },
+            { E::EASE_IN_QUART, E::EASE_OUT_QUART, E::EASE_IN_OUT_QUART },
+            { E::EASE_IN_QUINT, E::EASE_OUT_QUINT, E::EASE_IN_OUT_QUINT },
+            { E::EASE_IN_SINE, E::EASE_OUT_SINE, E::EASE_IN_OUT_SINE },
+            { E::EASE_IN_CIRC, E::EASE_OUT_CIRC, E::EASE_IN_OUT_CIRC },
+            { E::EASE_IN_BOUNCE, E::EASE_OUT_BOUNCE, E::EASE_IN_OUT_BOUNCE }
+        };
+
+        for (const auto& family : families) {
+            const auto in = C::Ease(family[0]);
+
+            for (int i = 0; i <= 16; ++i) {
+                const float alpha = float(i) / 16.0f;
+
+                EASING_TEST_CHECK_NEAR(C::Mirror(in).Value(alpha), E::GetEaseFromType(family[1], 0.0f, 1.0f, alpha), 1e-6, "Mirror of an In curve");
+                EASING_TEST_CHECK_NEAR(C::InOut(in).Value(alpha), E::GetEaseFromType(family[2], 0.0f, 1.0f, alpha), 1e-6, "InOut of an In curve");
+                EASING_TEST_CHECK_NEAR(C::Reverse(in).Value(alpha), E::GetEaseFromType(family[0], 0.0f, 1.0f, 1.0f - alpha), 0.0, "Reverse");
+            }
+        }
+
+        EASING_TEST_CHECK_NEAR(C::Ease<E::EASE_OUT_ELASTIC>().Evaluate(-2.0f, 6.0f, 0.3f),
+            C::Ease(E::EASE_OUT_ELASTIC).Evaluate(-2.0f, 6.0f, 0.3f), 0.0, "compile time and runtime presets");
+
+        // A rise to 0.8 that settles over the last 40%, blended with OutQuad and started after a quarter of the time.
+        const auto settle = C::Sequence(C::Ease<E::EASE_OUT_BACK>(), C::Ease<E::EASE_IN_OUT_SINE>(), 0.6f, 0.8f);
+        const auto blend = C::Blend(settle, C::Ease<E::EASE_OUT_QUAD>(), 0.25f);
+        const auto delayed = C::Retime(blend, 1.25f, -0.25f);
+
+        EASING_TEST_CHECK_NEAR(settle.Value(0.3f), 0.8 * E::GetEaseFromType(E::EASE_OUT_BACK, 0.0, 1.0, 0.5), 1e-6, "first curve of a sequence");
+        EASING_TEST_CHECK_NEAR(settle.Value(0.6f), 0.8, 1e-6, "sequence handover");
+        EASING_TEST_CHECK_NEAR(settle.Value(0.8f), 0.9, 1e-6, "second curve of a sequence");
+        EASING_TEST_CHECK_NEAR(settle.Value(1.0f), 1.0, 1e-6, "end of a sequence");
+        EASING_TEST_CHECK_NEAR(blend.Value(0.3f), 0.75 * settle.Value(0.3f) + 0.25 * 0.51, 1e-6, "blend");
+        EASING_TEST_CHECK_NEAR(delayed.Value(0.1f), 0.0, 0.0, "held during the delay");
+        EASING_TEST_CHECK_NEAR(delayed.Value(0.6f), blend.Value(0.5f), 1e-6, "retimed");
+        EASING_TEST_CHECK_NEAR(delayed.Slope(0.1f), 0.0, 0.0, "no slope during the delay");
+
+        for (int i = 1; i < 32; ++i) {
+            const double alpha = i / 32.0 + 0.01;
+            // The presets evaluate in double here too, so only the truncation of the difference is left in it.
+            const double slope = (delayed.Value(alpha + 1e-3) - delayed.Value(alpha - 1e-3)) / 2e-3;
+
+            EASING_TEST_CHECK_NEAR(delayed.Slope(alpha), slope, 1e-3 * (1.0 + std::fabs(slope)), "composed derivative");
+            EASING_TEST_CHECK_NEAR(delayed.EvaluateDerivative(-2.0, 6.0, alpha), 8.0 * slope, 8e-3 * (1.0 + std::fabs(slope)), "composed derivative, scaled");
+        }
+
+        float start[37];
+        float end[37];
+        float alphas[37];
+        float batch[37];
+
+        for (int i = 0; i < 37; ++i) {
+            start[i] = -2.0f;
+            end[i] = 6.0f;
+            alphas[i] = float(i) / 36.0f;
+        }
+
+        delayed.EvaluateBatch(start, end, alphas, batch, 37);
+
+        for (int i = 0; i < 37; ++i) {
+            EASING_TEST_CHECK_NEAR(batch[i], delayed(-2.0f, 6.0f, alphas[i]), 0.0, "composed batch");
+        }
+    }
+
+    //
+    // FNV-1a over the raw bits of every curve and derivative on a grid of alphas.
+    //
+    template<typename TFixed>
+    std::uint64_t HashFixedCurves()
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            for (int i = 0; i <= 256; ++i) {
+                const TFixed alpha = TFixed::FromRaw(typename TFixed::RawType(i) << (TFixed::Bits - 8));
+                const TFixed value = EasingFixedPoint::GetEaseFromType(EEaseType(type), TFixed::FromInt(-3), TFixed::FromInt(5), alpha);
+                const TFixed slope = EasingFixedPoint::GetEaseDerivativeFromType(EEaseType(type), TFixed::FromInt(-3), TFixed::FromInt(5), alpha);
+
+                for (const std::uint64_t raw : { std::uint64_t(value.Raw), std::uint64_t(slope.Raw) }) {
+                    for (int byte = 0; byte < int(sizeof(typename TFixed::RawType)); ++byte) {
+                        hash = (hash ^ ((raw >> (8 * byte)) & 0xFFu)) * 1099511628211ull;
+                    }
+                }
+            }
+        }
+
+        return hash;
+    }
+
+    template<typename TFixed>
+    void TestFixedPointFormat(double tolerance, double slopeTolerance)
+    {
+        typedef EasingFixedPoint F;
+
+        const TFixed zero = TFixed::FromInt(0);
+        const TFixed one = TFixed::FromInt(1);
+
+        for (const EaseCase& test : EaseCases) {
+            const TFixed alpha = TFixed::FromDouble(test.Alpha);
+
+            EASING_TEST_CHECK_NEAR(F::GetEaseFromType(test.EaseType, zero, one, alpha).ToDouble(), test.Expected, tolerance, "fixed GetEaseFromType");
+            EASING_TEST_CHECK_NEAR(F::GetEaseFromType(test.EaseType, TFixed::FromInt(-2), TFixed::FromInt(6), alpha).ToDouble(),
+                -2.0 + 8.0 * test.Expected, 8.0 * tolerance, "fixed GetEaseFromType scaled");
+        }
+
+        for (const EaseCase& test : DerivativeCases) {
+            EASING_TEST_CHECK_NEAR(F::GetEaseDerivativeFromType(test.EaseType, zero, one, TFixed::FromDouble(test.Alpha)).ToDouble(),
+                test.Expected, slopeTolerance * (1.0 + std::fabs(test.Expected)), "fixed GetEaseDerivativeFromType");
+        }
+
+        // Exact where the formula is, clamped outside [0, 1], and 0 for an unknown type.
+        EASING_TEST_CHECK_NEAR(F::Ease<E::EASE_IN_QUAD>(zero, one, TFixed::FromDouble(0.5)).Raw, TFixed::FromDouble(0.25).Raw, 0, "fixed InQuad exact");
+        EASING_TEST_CHECK_NEAR(F::Ease<E::EASE_OUT_BOUNCE>(zero, one, TFixed::FromDouble(0.25)).Raw, TFixed::FromDouble(0.47265625).Raw, 0, "fixed OutBounce exact");
+        EASING_TEST_CHECK_NEAR(F::Ease<E::EASE_OUT_BACK>(zero, one, TFixed::FromDouble(-0.5)).Raw, 0, 0, "fixed alpha clamped below");
+        EASING_TEST_CHECK_NEAR(F::Ease<E::EASE_OUT_ELASTIC>(zero, TFixed::FromInt(7), TFixed::FromDouble(1.5)).Raw, TFixed::FromInt(7).Raw, 0, "fixed alpha clamped above");
+        EASING_TEST_CHECK_NEAR(F::GetEaseFromType(EEaseType(E::EASE_TYPE_COUNT), zero, one, one).Raw, 0, 0, "fixed GetEaseFromType out of range");
+
+        // The vertical Circ tangents saturate with the sign of the range.
+        EASING_TEST_CHECK_NEAR(F::EaseDerivative<E::EASE_IN_CIRC>(zero, one, one) == TFixed::Max(), 1, 0, "fixed Circ slope saturates");
+        EASING_TEST_CHECK_NEAR(F::EaseDerivative<E::EASE_OUT_CIRC>(one, zero, zero) == TFixed::Lowest(), 1, 0, "fixed Circ slope saturates negative");
+        EASING_TEST_CHECK_NEAR(F::EaseDerivative<E::EASE_IN_OUT_CIRC>(one, one, TFixed::FromDouble(0.5)).Raw, 0, 0, "fixed Circ slope on an empty range");
+
+        TFixed start[37];
+        TFixed end[37];
+        TFixed alphas[37];
+        TFixed batch[37];
+        TFixed slopes[37];
+
+        for (int i = 0; i < 37; ++i) {
+            start[i] = TFixed::FromInt(-2);
+            end[i] = TFixed::FromInt(6);
+            alphas[i] = TFixed::FromDouble(i / 36.0);
+        }
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+
+            F::GetEaseFromTypeBatch(easeType, start, end, alphas, batch, 37);
+            F::GetEaseDerivativeFromTypeBatch(easeType, start, end, alphas, slopes, 37);
+
+            for (int i = 0; i < 37; ++i) {
+                EASING_TEST_CHECK_NEAR(batch[i] == F::GetEaseFromType(easeType, start[i], end[i], alphas[i]), 1, 0, "fixed batch");
+                EASING_TEST_CHECK_NEAR(slopes[i] == F::GetEaseDerivativeFromType(easeType, start[i], end[i], alphas[i]), 1, 0, "fixed derivative batch");
+
+                // Against the float curves, which are only float accurate themselves.
+                EASING_TEST_CHECK_NEAR(batch[i].ToDouble(), E::GetEaseFromType(easeType, -2.0f, 6.0f, float(alphas[i].ToDouble())),
+                    8.0 * tolerance + 8e-6, "fixed vs float");
+            }
+        }
+
+        for (int i = -40; i <= 40; ++i) {
+            const double x = i / 16.0 + 0.013;
+
+            EASING_TEST_CHECK_NEAR(F::SinTurns(TFixed::FromDouble(x)).ToDouble(), std::sin(2.0 * 3.14159265358979323846 * x), tolerance, "fixed SinTurns");
+            EASING_TEST_CHECK_NEAR(F::CosTurns(TFixed::FromDouble(x)).ToDouble(), std::cos(2.0 * 3.14159265358979323846 * x), tolerance, "fixed CosTurns");
+            EASING_TEST_CHECK_NEAR(F::Exp2(TFixed::FromDouble(x)).ToDouble(), std::exp2(x), tolerance * std::exp2(x), "fixed Exp2");
+
+            if (x > 0.0) {
+                EASING_TEST_CHECK_NEAR(F::Log2(TFixed::FromDouble(x)).ToDouble(), std::log2(TFixed::FromDouble(x).ToDouble()), tolerance, "fixed Log2");
+                EASING_TEST_CHECK_NEAR(F::Sqrt(TFixed::FromDouble(x)).Raw, TFixed::FromDouble(std::sqrt(TFixed::FromDouble(x).ToDouble())).Raw, x > 1.0 ? 8 : 0, "fixed Sqrt");
+            }
+        }
+    }
+
+    void TestFixedPoint()
+    {
+        typedef EasingFixedArithmetic<std::int64_t> Arithmetic;
+
+        static_assert(EasingFixedPoint::Ease<E::EASE_IN_OUT_QUAD>(EasingQ16::FromInt(0), EasingQ16::FromInt(1), EasingQ16::FromDouble(0.25)).Raw == 8192, "Q16 at compile time");
+        static_assert(EasingFixedPoint::Ease<E::EASE_OUT_SINE>(EasingQ32::FromInt(0), EasingQ32::FromInt(1), EasingQ32::FromInt(1)).Raw == 4294967296ll, "Q32 at compile time");
+
+        TestFixedPointFormat<EasingQ16>(1.5e-4, 1e-3);
+        TestFixedPointFormat<EasingQ32>(3e-9, 2e-8);
+
+        // The portable Q32.32 multiply and divide must round exactly like the __int128 ones.
+        std::uint64_t state = 0x2545F4914F6CDD1Dull;
+
+        for (int i = 0; i < 4096; ++i) {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            const std::int64_t a = std::int64_t(state) >> 22;
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            const std::int64_t b = std::int64_t(state) >> (22 + i % 20);
+
+            EASING_TEST_CHECK_NEAR(Arithmetic::MulPortable(a, b, 32) == Arithmetic::Mul(a, b, 32), 1, 0, "MulPortable");
+
+            if (b >= (std::int64_t(1) << 22) || b <= -(std::int64_t(1) << 22)) {
+                EASING_TEST_CHECK_NEAR(Arithmetic::DivPortable(a, b, 32) == Arithmetic::Div(a, b, 32), 1, 0, "DivPortable");
+            }
+        }
+
+        // Regenerate only for an intended change to the curves; any other difference breaks lockstep replays.
+        EASING_TEST_CHECK_NEAR(HashFixedCurves<EasingQ16>() == 10183886858771996791ull, 1, 0, "Q16.16 bits");
+        EASING_TEST_CHECK_NEAR(HashFixedCurves<EasingQ32>() == 8317917574743770820ull, 1, 0, "Q32.32 bits");
+    }
+
+    //
+    // Every 16 bit pattern widens and narrows back to itself, through the scalar and the array conversions (F16C when
+    // compiled in), and a packed batch gives exactly the float kernel's result rounded once.
+    //
+    template<typename TStorage>
+    void TestStorageFormat(const char* name)
+    {
+        typedef EasingPrecision<TStorage> P;
+        typedef EasingStorageTraits<TStorage> Traits;
+
+        static TStorage packed[65536];
+        static float wide[65536];
+        static TStorage narrowed[65536];
+
+        for (unsigned int bits = 0; bits < 65536; ++bits) {
+            packed[bits] = TStorage::FromBits(std::uint16_t(bits));
+        }
+
+        Traits::Widen(packed, wide, 65536);
+        Traits::Narrow(wide, narrowed, 65536);
+
+        int mismatches = 0;
+
+        for (unsigned int bits = 0; bits < 65536; ++bits) {
+            const float value = packed[bits].ToFloat();
+
+            if (value != value) {
+                mismatches += wide[bits] == wide[bits] || narrowed[bits].ToFloat() == narrowed[bits].ToFloat();
+                continue;
+            }
+
+            mismatches += TStorage::FromFloat(value).Bits != bits || narrowed[bits].Bits != bits;
+            mismatches += !(wide[bits] == value) || std::signbit(wide[bits]) != std::signbit(value);
+        }
+
+        EASING_TEST_CHECK_NEAR(mismatches, 0, 0, name);
+
+        // 1000 elements span several blocks and a partial one; out aliases alpha.
+        const std::size_t count = 1000;
+        static TStorage start[count];
+        static TStorage end[count];
+        static TStorage alpha[count];
+        static TStorage out[count];
+        static float wideStart[count];
+        static float wideEnd[count];
+        static float wideAlpha[count];
+        static float expected[count];
+
+        for (std::size_t i = 0; i < count; ++i) {
+            start[i] = TStorage::FromFloat(float(i % 7) - 3.0f);
+            end[i] = TStorage::FromFloat(float(i % 5) * 2.5f);
+            alpha[i] = TStorage::FromFloat(float(i) / float(count - 1));
+            wideStart[i] = start[i].ToFloat();
+            wideEnd[i] = end[i].ToFloat();
+        }
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+            TStorage* const results[2] = { out, alpha };
+            int wrong = 0;
+
+            for (int derivative = 0; derivative < 2; ++derivative) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    alpha[i] = TStorage::FromFloat(float(i) / float(count - 1));
+                    wideAlpha[i] = alpha[i].ToFloat();
+                }
+
+                if (derivative) {
+                    E::GetEaseDerivativeFromTypeBatch(easeType, wideStart, wideEnd, wideAlpha, expected, count);
+                    P::GetEaseDerivativeFromTypeBatch(easeType, start, end, alpha, results[type % 2], count);
+                } else {
+                    EasingFunctionsSimd::GetEaseFromTypeBatch(easeType, wideStart, wideEnd, wideAlpha, expected, count);
+                    P::GetEaseFromTypeBatch(easeType, start, end, alpha, results[type % 2], count);
+                }
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    wrong += results[type % 2][i].Bits != TStorage::FromFloat(expected[i]).Bits;
+                }
+            }
+
+            EASING_TEST_CHECK_NEAR(wrong, 0, 0, name);
+        }
+    }
+
+    void TestPrecision()
+    {
+        // Compute and return type follow T for every curve, not just the ones that were always templates.
+        static_assert(std::is_same<decltype(E::EaseInOutQuart(0.0, 1.0, 0.5)), double>::value, "EaseInOutQuart<double>");
+        static_assert(std::is_same<decltype(E::EaseOutElastic(0.0L, 1.0L, 0.5L)), long double>::value, "EaseOutElastic<long double>");
+        static_assert(std::is_same<decltype(E::EaseInBackD(0.0, 1.0, 0.5)), double>::value, "EaseInBackD<double>");
+        static_assert(std::is_same<decltype(E::LinearD(0.0, 1.0, 0.5)), double>::value, "LinearD<double>");
+        static_assert(std::is_same<EasingPrecision<EasingHalf>::Compute, float>::value, "half computes in float");
+        static_assert(std::is_same<EasingPrecision<double>::Compute, double>::value, "double computes in double");
+
+        // Past float precision: (1 - alpha)^2.2 and pi in double, where the float constants would be off by 1e-7.
+        EASING_TEST_CHECK_NEAR(E::EaseSpring(0.0, 1.0, 0.3), 0.7614199003978279, WideTolerance, "EaseSpring<double>");
+        EASING_TEST_CHECK_NEAR(E::EaseOutSine(0.0, 1.0, 1.0 / 3.0), 0.5, WideTolerance, "EaseOutSine<double>");
+        EASING_TEST_CHECK_NEAR(E::EaseInExpoD(0.0, 1.0, 1.0), 6.931471805599453, WideSlopeTolerance, "EaseInExpoD<double>");
+
+        const EasingHalf half = EasingPrecision<EasingHalf>::GetEaseFromType(E::EASE_OUT_BOUNCE, EasingHalf::FromFloat(0.0f),
+            EasingHalf::FromFloat(1.0f), EasingHalf::FromFloat(0.5f));
+        EASING_TEST_CHECK_NEAR(half.ToFloat(), 0.765625, 0.0, "EasingPrecision<EasingHalf>::GetEaseFromType");
+
+        double start[3] = { 0.0, 0.0, -2.0 };
+        double end[3] = { 1.0, 1.0, 6.0 };
+        double alpha[3] = { 0.3, 0.7, 0.5 };
+        double out[3];
+        EasingPrecision<double>::GetEaseFromTypeBatch(E::EASE_SPRING, start, end, alpha, out, 3);
+
+        for (int i = 0; i < 3; ++i) {
+            EASING_TEST_CHECK_NEAR(out[i], E::EaseSpring(start[i], end[i], alpha[i]), 0.0, "EasingPrecision<double> batch");
+        }
+
+        // Known encodings: rounding to nearest even, overflow, the subnormals and the signed zero.
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(1.0f).Bits, 0x3c00, 0, "half 1");
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(65504.0f).Bits, 0x7bff, 0, "half max");
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(65520.0f).Bits, 0x7c00, 0, "half overflow");
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(1.0f + 1.0f / 2048.0f).Bits, 0x3c00, 0, "half tie to even");
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(1.0f + 3.0f / 2048.0f).Bits, 0x3c02, 0, "half tie to even, odd");
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(5.9604644775390625e-8f).Bits, 0x0001, 0, "half smallest subnormal");
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(2.98023223876953125e-8f).Bits, 0x0000, 0, "half underflow tie");
+        EASING_TEST_CHECK_NEAR(EasingHalf::FromFloat(-0.0f).Bits, 0x8000, 0, "half -0");
+        EASING_TEST_CHECK_NEAR(EasingBFloat16::FromFloat(1.0f).Bits, 0x3f80, 0, "bfloat16 1");
+        EASING_TEST_CHECK_NEAR(EasingBFloat16::FromFloat(1.0f + 1.0f / 256.0f).Bits, 0x3f80, 0, "bfloat16 tie to even");
+        EASING_TEST_CHECK_NEAR(EasingBFloat16::FromFloat(1.0f + 3.0f / 256.0f).Bits, 0x3f82, 0, "bfloat16 tie to even, odd");
+
+        TestStorageFormat<EasingHalf>("EasingHalf");
+        TestStorageFormat<EasingBFloat16>("EasingBFloat16");
+    }
+
+    //
+    // `incremental` has a bit set for each curve the stepper carries forward rather than evaluates from alpha.
+    //
+    template<typename TStepper>
+    void TestStepperAgainstCurves(std::uint32_t incremental, const char* name)
+    {
+        // The InOut switch exactly on a tick, between ticks, and three ticks into a tween, and 18000 ticks that re-seed
+        // along the way. Differences that lost precision to cancellation would drift well past float rounding here.
+        const float durations[] = { 1.0f, 1.7f, 0.05f, 600.0f };
+        const float deltaTimes[] = { 0.125f, 1.0f / 60.0f, 1.0f / 60.0f, 1.0f / 30.0f };
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+
+            for (int c = 0; c < 4; ++c) {
+                TStepper stepper(easeType, -2.0f, 3.0f, durations[c], deltaTimes[c]);
+                const double rate = double(deltaTimes[c]) / double(durations[c]);
+                const std::uint64_t ticks = std::uint64_t(std::ceil(1.0 / rate));
+                double worst = std::fabs(stepper.GetValue() - E::GetEaseFromType(easeType, -2.0, 3.0, 0.0));
+
+                for (std::uint64_t step = 1; step <= ticks + 2; ++step) {
+                    const double alpha = std::fmin(double(step) * rate, 1.0);
+                    const float value = stepper.Next();
+
+                    worst = std::fmax(worst, std::fabs(value - E::GetEaseFromType(easeType, -2.0, 3.0, alpha)));
+                }
+
+                EASING_TEST_CHECK_NEAR(worst, 0.0, 5e-7, name);
+                EASING_TEST_CHECK_NEAR(stepper.IsFinished(), 1, 0, name);
+                EASING_TEST_CHECK_NEAR(stepper.GetAlpha(), 1.0, 0.0, name);
+                EASING_TEST_CHECK_NEAR(stepper.IsIncremental(), (incremental >> type) & 1u, 0, name);
+            }
+        }
+    }
+
+    void TestStepper()
+    {
+        std::uint32_t polynomial = 1u << E::EASE_LINEAR;
+        std::uint32_t recurrence = 0;
+
+        for (unsigned int type = E::EASE_IN_QUAD; type <= E::EASE_IN_OUT_QUINT; ++type) {
+            polynomial |= 1u << type;
+        }
+
+        for (unsigned int type = E::EASE_IN_SINE; type <= E::EASE_IN_OUT_EXPO; ++type) {
+            recurrence |= 1u << type;
+        }
+
+        recurrence |= (1u << E::EASE_IN_ELASTIC) | (1u << E::EASE_OUT_ELASTIC) | (1u << E::EASE_IN_OUT_ELASTIC);
+
+        TestStepperAgainstCurves<EasingPolynomialStepper>(polynomial, "EasingPolynomialStepper against GetEaseFromType");
+        TestStepperAgainstCurves<EasingRecurrenceStepper>(recurrence, "EasingRecurrenceStepper against GetEaseFromType");
+
+        // Finishes on the tick where alpha reaches 1, lands exactly on the end value and holds it.
+        EasingPolynomialStepper stepper(E::EASE_IN_OUT_QUINT, 0.0f, 10.0f, 1.0f, 0.1f);
+
+        for (int i = 0; i < 9; ++i) {
+            stepper.Next();
+        }
+
+        EASING_TEST_CHECK_NEAR(stepper.IsFinished(), 0, 0, "EasingPolynomialStepper before the end");
+        EASING_TEST_CHECK_NEAR(stepper.Next(), 10.0, 0.0, "EasingPolynomialStepper end value");
+        EASING_TEST_CHECK_NEAR(stepper.Next(), 10.0, 0.0, "EasingPolynomialStepper holds the end value");
+        EASING_TEST_CHECK_NEAR(stepper.GetStep(), 10, 0, "EasingPolynomialStepper stops counting");
+
+        // A zero length tween is finished at once; a zero step never moves.
+        EasingPolynomialStepper empty(E::EASE_OUT_CUBIC, 1.0f, 5.0f, 0.0f, 0.1f);
+        EASING_TEST_CHECK_NEAR(empty.GetValue(), 5.0, 0.0, "EasingPolynomialStepper zero duration");
+        EASING_TEST_CHECK_NEAR(empty.IsFinished(), 1, 0, "EasingPolynomialStepper zero duration finished");
+
+        EasingPolynomialStepper stalled(E::EASE_OUT_CUBIC, 1.0f, 5.0f, 1.0f, 0.0f);
+        stalled.Next();
+        EASING_TEST_CHECK_NEAR(stalled.Next(), 1.0, 0.0, "EasingPolynomialStepper zero step");
+        EASING_TEST_CHECK_NEAR(stalled.IsFinished(), 0, 0, "EasingPolynomialStepper zero step finished");
+    }
+
+    void TestEnvelope()
+    {
+        // A duration short enough for the batch path, and offsets before the start, on it, between samples and across
+        // the end. Float alphas cost Circ about 1e-5 next to its vertical tangent; everything else is within 2e-6.
+        const double durations[] = { 10.5, 1000.0, 17760.0 };
+        const double offsets[] = { -37.0, 0.0, 123.25, 16900.0 };
+        const std::size_t count = 2000;
+        static float out[count];
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+            double worst = 0.0;
+
+            for (double duration : durations) {
+                for (double offset : offsets) {
+                    const EasingEnvelope envelope(easeType, -2.0f, 3.0f, duration);
+                    envelope.Render(offset, out, count);
+
+                    for (std::size_t i = 0; i < count; ++i) {
+                        const double alpha = std::fmin(std::fmax((offset + double(i)) / duration, 0.0), 1.0);
+                        const double expected = alpha > 0.0
+                            ? E::GetEaseFromType(easeType, -2.0, 3.0, alpha)
+                            : E::GetEaseFromType(easeType, -2.0f, 3.0f, 0.0f);
+
+                        worst = std::fmax(worst, std::fabs(out[i] - expected));
+                    }
+                }
+            }
+
+            EASING_TEST_CHECK_NEAR(worst, 0.0, 2e-5, "EasingEnvelope against GetEaseFromType");
+        }
+
+        // Sample accurate: the sample at alpha 1 is the first to hold the end, however the blocks are cut.
+        EasingEnvelope release(E::EASE_OUT_EXPO, 1.0f, 0.0f, 100.0);
+        float blocks[3][64];
+        release.Process(blocks[0], 64);
+        release.Process(blocks[1], 35);
+        release.Process(blocks[2], 64);
+
+        EASING_TEST_CHECK_NEAR(blocks[0][0], 1.0, 0.0, "EasingEnvelope first sample");
+        EASING_TEST_CHECK_NEAR(blocks[1][34], E::EaseOutExpo(1.0, 0.0, 0.98), 1e-6, "EasingEnvelope sample 98");
+        EASING_TEST_CHECK_NEAR(blocks[2][0], E::EaseOutExpo(1.0, 0.0, 0.99), 1e-6, "EasingEnvelope sample 99");
+        EASING_TEST_CHECK_NEAR(blocks[2][1], E::EaseOutExpo(1.0f, 0.0f, 1.0f), 0.0, "EasingEnvelope end value");
+        EASING_TEST_CHECK_NEAR(blocks[2][63], E::EaseOutExpo(1.0f, 0.0f, 1.0f), 0.0, "EasingEnvelope holds the end value");
+        EASING_TEST_CHECK_NEAR(release.IsFinished(), 1, 0, "EasingEnvelope finished");
+
+        // Bit for bit the same span from one Render and from uneven Process calls, cut inside groups, seeds and halves.
+        const double cutDurations[] = { 20.0, 777.0, 18000.0 };
+        const std::size_t cuts[] = { 1, 15, 17, 500, 513, 2, 4000, 31, 1024, 6000, 333, 7564 };
+        const std::size_t span = 20000;
+        static float whole[span];
+        static float pieces[span];
+
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            const EEaseType easeType = EEaseType(type);
+            int mismatches = 0;
+
+            for (double duration : cutDurations) {
+                EasingEnvelope envelope(easeType, -2.0f, 3.0f, duration);
+                envelope.Render(-40.0, whole, span);
+
+                envelope.Seek(-40.0);
+                std::size_t done = 0;
+
+                for (std::size_t cut : cuts) {
+                    envelope.Process(pieces + done, cut);
+                    done += cut;
+                }
+
+                mismatches += done == span && std::memcmp(whole, pieces, sizeof(whole)) == 0 ? 0 : 1;
+            }
+
+            EASING_TEST_CHECK_NEAR(mismatches, 0, 0, "EasingEnvelope the same however the blocks are cut");
+        }
+    }
+
+    void TestFloatDoubleAgreement()
+    {
+        for (unsigned int type = 0; type < E::EASE_TYPE_COUNT; ++type) {
+            for (int i = 0; i <= 32; ++i) {
+                const float alpha = float(i) / 32.0f;
+
+                EASING_TEST_CHECK_NEAR(E::GetEaseFromType(EEaseType(type), 0.0f, 1.0f, alpha),
+                    E::GetEaseFromType(EEaseType(type), 0.0, 1.0, double(alpha)), 1e-5, "float vs double");
+            }
+        }
+    }
+}
+
+int main()
+{
+    TestEases();
+    TestDerivatives();
+    TestVectors();
+    TestTweenPool();
+    TestWorkerPool();
+    TestParallelTweenPool();
+    TestInverse<float>();
+    TestInverse<double>();
+    TestIntegrals();
+    TestCurves();
+    TestCompose();
+    TestFixedPoint();
+    TestPrecision();
+    TestStepper();
+    TestEnvelope();
+    TestFloatDoubleAgreement();
+
+    std::printf("%d checks, %d failures\n", Checks, Failures);
+    return Failures == 0 ? 0 : 1;
+}
@@ -1 +1,59 @@
-#!/usr/bin/env python3
\ No newline at end of file
+#!/usr/bin/env python3
+
+import os
+import shutil
+import subprocess
+
+import pytest
+
+REPO_ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+TEST_SOURCE = os.path.join(REPO_ROOT, "tests", "NativeCpp_test.cpp")
+INCLUDE_DIR = os.path.join(REPO_ROOT, "native_cpp")
+SANITIZER_FLAGS = ["-fsanitize=address,undefined", "-fno-sanitize-recover=all", "-fno-omit-frame-pointer"]
+
+def find_compiler():
+    """
+    Find a C++ compiler on the PATH.
+
+    Returns:
+        str: The compiler command, or None if there is none.
+    """
+    for compiler in (os.environ.get("CXX"), "g++", "clang++", "c++"):
+        if compiler and shutil.which(compiler):
+            return compiler
+    return None
+
+def build(compiler, standard, output, sanitize):
+    """
+    Compile tests/NativeCpp_test.cpp.
+
+    Args:
+        compiler (str): The compiler command.
+        standard (str): The -std value, e.g. c++14.
+        output (str): The path of the executable to write.
+        sanitize (bool): Whether to build with AddressSanitizer and UndefinedBehaviorSanitizer.
+
+    Returns:
+        subprocess.CompletedProcess: The compiler run.
+    """
+    command = [compiler, "-std=" + standard, "-O1", "-Wall", "-pthread", "-I" + INCLUDE_DIR, TEST_SOURCE, "-o", output]
+    if sanitize:
+        command[1:1] = SANITIZER_FLAGS
+    return subprocess.run(command, capture_output=True, text=True)
+
+@pytest.mark.parametrize("standard", ["c++14", "c++17"])
+def test_native_cpp(standard, tmp_path):
+    compiler = find_compiler()
+    if compiler is None:
+        pytest.skip("no C++ compiler found")
+
+    output = str(tmp_path / "NativeCpp_test")
+
+    # Not every toolchain ships the sanitizer runtimes; the checks still run without them.
+    result = build(compiler, standard, output, sanitize=True)
+    if result.returncode != 0:
+        result = build(compiler, standard, output, sanitize=False)
+    assert result.returncode == 0, result.stderr
+
+    run = subprocess.run([output], capture_output=True, text=True)
+    assert run.returncode == 0, run.stdout + run.stderr